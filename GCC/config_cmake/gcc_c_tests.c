@@ -739,6 +739,26 @@ int main()
 }
 #endif
 
+/*--------------------------------------------------------------------------*/
+#ifdef TEST_HAVE_ATOMIC_BUILTINS
+int main()
+{
+  static void* p;
+  static void* q;
+  static unsigned int n;
+  static unsigned char lock;
+  while (__atomic_test_and_set (&lock, __ATOMIC_ACQUIRE))
+    ;
+  __atomic_store_n (&p, __atomic_load_n (&q, __ATOMIC_ACQUIRE),
+                    __ATOMIC_RELEASE);
+  __atomic_compare_exchange_n (&q, &p, &n, 0, __ATOMIC_RELEASE,
+                               __ATOMIC_RELAXED);
+  __atomic_add_fetch (&n, 1, __ATOMIC_RELAXED);
+  __atomic_clear (&lock, __ATOMIC_RELEASE);
+  return p != 0;
+}
+#endif
+
 /*--------------------------------------------------------------------------*/
 #ifdef TEST_TM_IN_TIME_H
 #if HAVE_SYS_TYPES_H
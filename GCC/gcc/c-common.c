@@ -229,6 +229,19 @@ bool flag_pch_preprocess;
 
 const char *pch_file;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The startup image to restore if it is valid for this compilation,
+   and the one to write, or NULL.  */
+
+const char *startup_image_file;
+const char *startup_image_output;
+
+/* Nonzero if the state after initialization and the -include files
+   was restored from startup_image_file.  */
+
+bool startup_image_restored;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Nonzero if an ISO standard was selected.  It rejects macros in the
    user's namespace.  */
 int flag_iso;
@@ -479,6 +492,10 @@ const char* flag_xml;
 
 /* Start locations for dump of translation unit.  */
 const char* flag_xml_start;
+
+/* Plugin library receiving the dump, and its argument.  */
+const char* flag_xml_plugin;
+const char* flag_xml_plugin_arg;
 /* END GCC-XML MODIFICATIONS ($Date: 2007-10-31 15:06:58 $) */
 
 /* Information about how a function name is generated.  */
@@ -362,6 +362,19 @@ extern bool flag_pch_preprocess;
 
 extern const char *pch_file;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The startup image to restore if it is valid for this compilation,
+   and the one to write, or NULL.  */
+
+extern const char *startup_image_file;
+extern const char *startup_image_output;
+
+/* Nonzero if the state after initialization and the -include files
+   was restored from startup_image_file.  */
+
+extern bool startup_image_restored;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Nonzero if an ISO standard was selected.  It rejects macros in the
    user's namespace.  */
 
@@ -597,6 +610,10 @@ extern const char* flag_xml;
 
 /* Start locations for dump of translation unit.  */
 extern const char* flag_xml_start;
+
+/* Plugin library receiving the dump, and its argument.  */
+extern const char* flag_xml_plugin;
+extern const char* flag_xml_plugin_arg;
 /* END GCC-XML MODIFICATIONS ($Date: 2007-10-31 15:06:58 $) */
 
 /* C types are partitioned into three subsets: object, function, and
@@ -873,6 +890,11 @@ extern void c_common_write_pch (void);
 extern void c_common_no_more_pch (void);
 extern void c_common_pch_pragma (cpp_reader *pfile, const char *);
 extern void c_common_print_pch_checksum (FILE *f);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern bool c_common_read_startup_image (void);
+extern void c_common_write_startup_image (void);
+extern void c_common_note_startup_image_file (const char *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* In *-checksum.c */
 extern const unsigned char executable_checksum[16];
@@ -197,7 +197,13 @@ remove_duplicates (cpp_reader *pfile, struct cpp_dir *head,
 
       cur = *pcur;
 
-      if (stat (cur->name, &st))
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* A directory that only holds -fvirtual-files entries is kept
+         like one that exists.  */
+      if (stat (cur->name, &st)
+          && !(errno == ENOENT && cpp_stat_virtual_file (pfile, cur->name,
+                                                          &st)))
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
         {
           /* Dirs that don't exist are silently ignored, unless verbose.  */
           if (errno != ENOENT)
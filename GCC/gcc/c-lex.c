@@ -60,6 +60,9 @@ int c_lex_string_translate = 1;
 bool c_lex_return_raw_strings = false;
 
 static tree interpret_integer (const cpp_token *, unsigned int);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static bool interpret_simple_integer (const cpp_token *, tree *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 static tree interpret_float (const cpp_token *, unsigned int);
 static enum integer_type_kind narrowest_unsigned_type
         (unsigned HOST_WIDE_INT, unsigned HOST_WIDE_INT, unsigned int);
@@ -357,7 +360,18 @@ c_lex_with_flags (tree *value, location_t *loc, unsigned char *cpp_flags)
 
     case CPP_NUMBER:
       {
-        unsigned int flags = cpp_classify_number (parse_in, tok);
+        unsigned int flags;
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+        if (interpret_simple_integer (tok, value))
+          {
+            if (tok->val.str.len == 1 && *tok->val.str.text == '0')
+              add_flags = PURE_ZERO;
+            break;
+          }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
+        flags = cpp_classify_number (parse_in, tok);
 
         switch (flags & CPP_N_CATEGORY)
           {
@@ -550,6 +564,50 @@ narrowest_signed_type (unsigned HOST_WIDE_INT low,
   return itk_none;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* If TOKEN is a decimal number of at most nine digits or a hexadecimal
+   one of at most seven, without a suffix, store its value in *VALUE
+   and return true.  These are most of the numbers in a program, and
+   the entries of generated data tables, and always have type int, so
+   they need none of the work cpp_classify_number and interpret_integer
+   do for the general case.  */
+static bool
+interpret_simple_integer (const cpp_token *token, tree *value)
+{
+  const unsigned char *p = token->val.str.text;
+  const unsigned char *end = p + token->val.str.len;
+  HOST_WIDE_INT n = 0;
+
+  if (TYPE_PRECISION (integer_type_node) < 32)
+    return false;
+
+  if (p[0] == '0' && end - p > 2 && (p[1] == 'x' || p[1] == 'X'))
+    {
+      if (end - p > 2 + 7)
+        return false;
+      for (p += 2; p != end; p++)
+        if (!ISXDIGIT (*p))
+          return false;
+        else
+          n = n * 16 + (ISDIGIT (*p) ? *p - '0' : TOLOWER (*p) - 'a' + 10);
+    }
+  else
+    {
+      /* A leading zero makes an octal number, other than 0 itself.  */
+      if (end - p > 9 || (p[0] == '0' && end - p != 1))
+        return false;
+      for (; p != end; p++)
+        if (!ISDIGIT (*p))
+          return false;
+        else
+          n = n * 10 + (*p - '0');
+    }
+
+  *value = build_int_cst (integer_type_node, n);
+  return true;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Interpret TOKEN, an integer with FLAGS as classified by cpplib.  */
 static tree
 interpret_integer (const cpp_token *token, unsigned int flags)
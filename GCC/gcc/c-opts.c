@@ -107,6 +107,12 @@ static size_t deferred_count;
 /* Number of deferred options scanned for -include.  */
 static size_t include_cursor;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The files given by -fvirtual-files=, in order.  */
+static const char **virtual_files_names;
+static size_t num_virtual_files_names;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 static void set_Wimplicit (int);
 static void handle_OPT_d (const char *);
 static void set_std_cxx98 (int);
@@ -120,6 +126,11 @@ static void push_command_line_include (void);
 static void cb_file_change (cpp_reader *, const struct line_map *);
 static void cb_dir_change (cpp_reader *, const char *);
 static void finish_options (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static void read_virtual_files (const char *);
+static bool warnings_reclassified_p (void);
+static void disable_warning_only_analyses (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifndef STDC_0_IN_SYSTEM_HEADERS
 #define STDC_0_IN_SYSTEM_HEADERS 0
@@ -597,6 +608,16 @@ c_common_handle_option (size_t scode, const char *arg, int value)
         flag_xml_start = arg;
       break;
 
+    case OPT_fxml_plugin_:
+      if(value)
+        flag_xml_plugin = arg;
+      break;
+
+    case OPT_fxml_plugin_arg_:
+      if(value)
+        flag_xml_plugin_arg = arg;
+      break;
+
     case OPT_faccess_control:
       flag_access_control = value;
       break;
@@ -616,6 +637,22 @@ c_common_handle_option (size_t scode, const char *arg, int value)
         disable_builtin_function (arg);
       break;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    case OPT_fcache_include_dirs:
+      cpp_opts->cache_include_dirs = (value ? CPP_CACHE_DIRS_ALL
+                                     : CPP_CACHE_DIRS_NONE);
+      break;
+
+    case OPT_fcache_include_dirs_:
+      if (!strcmp (arg, "all"))
+        cpp_opts->cache_include_dirs = CPP_CACHE_DIRS_ALL;
+      else if (!strcmp (arg, "system"))
+        cpp_opts->cache_include_dirs = CPP_CACHE_DIRS_SYSTEM;
+      else
+        error ("unrecognized argument to -fcache-include-dirs=: %qs", arg);
+      break;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
     case OPT_fdollars_in_identifiers:
       cpp_opts->dollars_in_ident = value;
       break;
@@ -774,6 +811,16 @@ c_common_handle_option (size_t scode, const char *arg, int value)
       cpp_opts->show_column = value;
       break;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    case OPT_fstartup_image_:
+      startup_image_file = arg;
+      break;
+
+    case OPT_fstartup_image_output_:
+      startup_image_output = arg;
+      break;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
     case OPT_fstats:
       flag_detailed_statistics = value;
       break;
@@ -808,6 +855,14 @@ c_common_handle_option (size_t scode, const char *arg, int value)
       flag_use_cxa_get_exception_ptr = value;
       break;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    case OPT_fvirtual_files_:
+      virtual_files_names = XRESIZEVEC (const char *, virtual_files_names,
+                                        num_virtual_files_names + 1);
+      virtual_files_names[num_virtual_files_names++] = arg;
+      break;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
     case OPT_fvisibility_inlines_hidden:
       visibility_options.inlines_hidden = value;
       break;
@@ -991,6 +1046,9 @@ bool
 c_common_post_options (const char **pfilename)
 {
   struct cpp_callbacks *cb;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  size_t i;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Canonicalize the input and output filenames.  */
   if (in_fnames == NULL)
@@ -1011,6 +1069,13 @@ c_common_post_options (const char **pfilename)
 
   sanitize_cpp_opts ();
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* The include chains need to see the directories that only exist
+     in the virtual files.  */
+  for (i = 0; i < num_virtual_files_names; i++)
+    read_virtual_files (virtual_files_names[i]);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   register_include_chains (parse_in, sysroot, iprefix, imultilib,
                            std_inc, std_cxx_inc && c_dialect_cxx (), verbose);
 
@@ -1081,6 +1146,17 @@ c_common_post_options (const char **pfilename)
                "-Wformat-security ignored without -Wformat");
     }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* With -w only errors can be reported, unless some -Werror= option
+     makes errors of warnings.  gccxml always passes -w, so skip the
+     analyses whose only product is a warning instead of running them
+     and dropping the result.  This does not depend on
+     flag_pedantic_errors, which the C++ front end only sets later,
+     since the flags that also gate a pedwarn are not cleared.  */
+  if (inhibit_warnings && !warnings_reclassified_p ())
+    disable_warning_only_analyses ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* C99 requires special handling of complex multiplication and division;
      -ffast-math and -fcx-limited-range are handled in process_options.  */
   if (flag_isoc99)
@@ -1391,6 +1467,19 @@ add_prefixed_path (const char *suffix, size_t chain)
 static void
 finish_options (void)
 {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* A restored startup image already holds the macros and the
+     declarations of the -include files, so only the main file is
+     left to start.  */
+  if (startup_image_restored)
+    {
+      cpp_opts->warn_dollars = (cpp_opts->pedantic && !cpp_opts->c99);
+      include_cursor = deferred_count;
+      push_command_line_include ();
+      return;
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   if (!cpp_opts->preprocessed)
     {
       size_t i;
@@ -1453,6 +1542,167 @@ finish_options (void)
   push_command_line_include ();
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return true if a -Werror= option turned some warning into an
+   error, which -w does not suppress.  */
+static bool
+warnings_reclassified_p (void)
+{
+  size_t i;
+
+  for (i = 0; i < N_OPTS; i++)
+    if (global_dc->classify_diagnostic[i] == DK_ERROR)
+      return true;
+  return false;
+}
+
+/* Clear the flags that only decide whether to warn, so the checks they
+   guard are not run at all: format and nonnull checking of calls,
+   sequence point verification, shadowing lookups, unused entity
+   tracking and the like.  Only used when no warning can be
+   reported.  The flags that also decide whether a pedwarn is given
+   (warn_pointer_arith, warn_overflow, warn_return_type,
+   extra_warnings and cpplib's warn_endif_labels) are left alone: a
+   pedwarn is an error with -pedantic-errors, and always in C++
+   without -fpermissive.  So is warn_deprecated, which also decides
+   whether __DEPRECATED is defined.  */
+static void
+disable_warning_only_analyses (void)
+{
+  warn_format = 0;
+  warn_format_extra_args = 0;
+  warn_format_nonliteral = 0;
+  warn_format_security = 0;
+  warn_format_y2k = 0;
+  warn_format_zero_length = 0;
+  warn_missing_format_attribute = 0;
+  warn_nonnull = 0;
+  warn_strict_null_sentinel = 0;
+  warn_sequence_point = 0;
+  warn_shadow = 0;
+  warn_parentheses = 0;
+  warn_missing_braces = 0;
+  warn_missing_field_initializers = 0;
+  warn_char_subscripts = 0;
+  warn_sign_compare = 0;
+  warn_sign_promo = 0;
+  warn_conversion = 0;
+  warn_cast_align = 0;
+  warn_cast_qual = 0;
+  warn_old_style_cast = 0;
+  warn_float_equal = 0;
+  warn_address = 0;
+  warn_div_by_zero = 0;
+  warn_switch = 0;
+  warn_switch_default = 0;
+  warn_switch_enum = 0;
+  warn_unused_function = 0;
+  warn_unused_label = 0;
+  warn_unused_parameter = 0;
+  warn_unused_value = 0;
+  warn_unused_variable = 0;
+  warn_uninitialized = 0;
+  warn_unknown_pragmas = 0;
+  warn_redundant_decls = 0;
+  warn_deprecated_decl = 0;
+  warn_abi = 0;
+  warn_ctor_dtor_privacy = 0;
+  warn_nonvdtor = 0;
+  warn_overloaded_virtual = 0;
+  warn_reorder = 0;
+  warn_synth = 0;
+  warn_ecpp = 0;
+  warn_inline = 0;
+  warn_padded = 0;
+  warn_packed = 0;
+  warn_unused_macros = false;
+
+  cpp_opts->warn_comments = 0;
+  cpp_opts->warn_deprecated = 0;
+  cpp_opts->warn_missing_include_dirs = 0;
+  cpp_opts->warn_multichar = 0;
+  cpp_opts->warn_normalize = normalized_none;
+  cpp_opts->warn_num_sign_change = 0;
+  cpp_opts->warn_trigraphs = 0;
+  cpp_opts->warn_undef = 0;
+}
+
+/* Read the files given by -fvirtual-files=NAME and hand them to cpplib.
+   NAME holds a sequence of entries, each a line with the decimal size
+   of the file, a space and its path, followed by exactly that many
+   bytes of contents.  "-" reads the entries from standard input, so
+   a caller can pass sources without writing them anywhere.  A path
+   given again, here or in a later -fvirtual-files= file, replaces the
+   earlier contents.  A path that is also a directory of another entry
+   is an error.  */
+static void
+read_virtual_files (const char *name)
+{
+  FILE *f = strcmp (name, "-") ? fopen (name, "rb") : stdin;
+  bool malformed = false;
+  int ch;
+
+  if (f == NULL)
+    {
+      fatal_error ("opening virtual file list %s: %m", name);
+      return;
+    }
+
+  while ((ch = getc (f)) != EOF)
+    {
+      size_t len = 0, path_len = 0, path_alloc = 64;
+      char *path;
+      unsigned char *buffer;
+
+      while (ISDIGIT (ch))
+        {
+          len = len * 10 + (ch - '0');
+          ch = getc (f);
+        }
+      if (ch != ' ')
+        {
+          malformed = true;
+          break;
+        }
+
+      path = XNEWVEC (char, path_alloc);
+      while ((ch = getc (f)) != EOF && ch != '\n')
+        {
+          if (path_len + 1 == path_alloc)
+            path = XRESIZEVEC (char, path, path_alloc *= 2);
+          path[path_len++] = ch;
+        }
+      path[path_len] = '\0';
+
+      buffer = XNEWVEC (unsigned char, len + 1);
+      if (ch != '\n' || path_len == 0 || fread (buffer, 1, len, f) != len)
+        {
+          free (path);
+          free (buffer);
+          malformed = true;
+          break;
+        }
+
+      /* cpplib keeps the contents for the rest of the run.  */
+      if (!cpp_add_virtual_file (parse_in, path, buffer, len))
+        {
+          error ("virtual file %s conflicts with an earlier virtual "
+                 "file or directory", path);
+          free (buffer);
+        }
+      free (path);
+    }
+
+  if (ferror (f))
+    error ("reading virtual file list %s: %m", name);
+  else if (malformed)
+    error ("malformed virtual file list %s", name);
+
+  if (f != stdin)
+    fclose (f);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Give CPP the next file given by -include, if any.  */
 static void
 push_command_line_include (void)
@@ -1491,6 +1741,12 @@ cb_file_change (cpp_reader * ARG_UNUSED (pfile),
   else
     fe_file_change (new_map);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (startup_image_output && new_map && new_map->reason == LC_ENTER
+      && !MAIN_FILE_P (new_map))
+    c_common_note_startup_image_file (new_map->to_file);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   if (new_map == 0 || (new_map->reason == LC_LEAVE && MAIN_FILE_P (new_map)))
     push_command_line_include ();
 }
@@ -34,6 +34,10 @@ Boston, MA 02110-1301, USA.  */
 #include "langhooks.h"
 #include "hosthooks.h"
 #include "target.h"
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#include "diagnostic.h"
+#include "md5.h"
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* This is a list of flag variables that must match exactly, and their
    names for the error message.  The possible values for *flag_var must
@@ -479,3 +483,309 @@ c_common_print_pch_checksum (FILE *f)
     fprintf (f, "%02x", executable_checksum[i]);
   putc ('\n', f);
 }
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+
+/* A startup image holds the state of the compiler once it has
+   initialized and read the -include files of an empty translation
+   unit: the global type nodes and builtin declarations, the reserved
+   words and operator names, and the macros and declarations of the
+   -include files.  It is written with the PCH machinery.  A later
+   compilation restores it in place of building that state again,
+   provided it runs the executable that wrote the image, from the same
+   directory, with the same options apart from the input and output
+   files, and the files the image read are unchanged.  */
+
+static const char startup_image_ident[IDENT_LENGTH] = "gxsi.001";
+
+/* The files entered while building the state written to
+   startup_image_output, other than the main file.  */
+static const char **startup_image_files;
+static size_t num_startup_image_files;
+
+/* Note that FILENAME was entered while building the state to write to
+   startup_image_output.  */
+
+void
+c_common_note_startup_image_file (const char *filename)
+{
+  size_t i;
+
+  for (i = 0; i < num_startup_image_files; i++)
+    if (strcmp (startup_image_files[i], filename) == 0)
+      return;
+
+  startup_image_files = XRESIZEVEC (const char *, startup_image_files,
+                                    num_startup_image_files + 1);
+  startup_image_files[num_startup_image_files++] = xstrdup (filename);
+}
+
+/* Return true if ARG, at *ARGP in save_argv, names the input file or
+   is an option that cannot change the state in a startup image.
+   Advance *ARGP past the argument of a separate -o, -dumpbase,
+   -auxbase or -auxbase-strip, which name the output files.  */
+
+static bool
+startup_image_ignored_arg_p (const char ***argp)
+{
+  static const char *const ignored[] = {
+    "-fstartup-image", "-fstartup-image-output=", "-fvirtual-files=",
+    "-fxml=", "-fxml-start=", "-fxml-plugin=", "-fxml-plugin-arg=",
+    "-ftime-report", "-quiet"
+  };
+  const char *arg = **argp;
+  size_t i;
+
+  if (strcmp (arg, "-o") == 0
+      || strcmp (arg, "-dumpbase") == 0
+      || strcmp (arg, "-auxbase") == 0
+      || strcmp (arg, "-auxbase-strip") == 0)
+    {
+      if ((*argp)[1])
+        ++*argp;
+      return true;
+    }
+  if (strncmp (arg, "-o", 2) == 0
+      || (main_input_filename && strcmp (arg, main_input_filename) == 0))
+    return true;
+  for (i = 0; i < ARRAY_SIZE (ignored); i++)
+    if (strncmp (arg, ignored[i], strlen (ignored[i])) == 0)
+      return true;
+  return false;
+}
+
+/* Compute in KEY the checksum of what a startup image must have been
+   written under to be valid now.  Return false if the running
+   executable cannot be found.  */
+
+static bool
+startup_image_key (unsigned char key[16])
+{
+  struct md5_ctx ctx;
+  struct stat st;
+  const char *pwd = getpwd ();
+  const char **p;
+  void (*text) (void) = &c_common_write_startup_image;
+
+  /* The image holds pointers into the text segment, so it is only
+     good for the same executable loaded at the same address.  */
+  if (stat ("/proc/self/exe", &st) != 0 && stat (save_argv[0], &st) != 0)
+    return false;
+
+  md5_init_ctx (&ctx);
+  md5_process_bytes (startup_image_ident, IDENT_LENGTH, &ctx);
+  md5_process_bytes (&st.st_dev, sizeof (st.st_dev), &ctx);
+  md5_process_bytes (&st.st_ino, sizeof (st.st_ino), &ctx);
+  md5_process_bytes (&st.st_size, sizeof (st.st_size), &ctx);
+  md5_process_bytes (&st.st_mtime, sizeof (st.st_mtime), &ctx);
+  md5_process_bytes (&text, sizeof (text), &ctx);
+
+  /* -include looks in the working directory first.  */
+  if (pwd)
+    md5_process_bytes (pwd, strlen (pwd) + 1, &ctx);
+
+  for (p = save_argv + 1; *p; p++)
+    if (!startup_image_ignored_arg_p (&p))
+      md5_process_bytes (*p, strlen (*p) + 1, &ctx);
+
+  md5_finish_ctx (&ctx, key);
+  return true;
+}
+
+/* Compute in SUM the checksum of the contents of FILENAME, and store
+   its size in *SIZE.  Return false if it cannot be read or is one of
+   the -fvirtual-files, whose contents may change between
+   compilations with the same options.  */
+
+static bool
+startup_image_file_sum (const char *filename, unsigned char sum[16],
+                        off_t *size)
+{
+  struct stat st;
+  FILE *f;
+  bool ok;
+
+  if (cpp_stat_virtual_file (parse_in, filename, &st))
+    return false;
+
+  f = fopen (filename, "rb");
+  if (f == NULL)
+    return false;
+  ok = (fstat (fileno (f), &st) == 0 && md5_stream (f, sum) == 0);
+  *size = st.st_size;
+  fclose (f);
+  return ok;
+}
+
+/* Write the current state to startup_image_output.  This is called
+   when the parser reaches the end of the translation unit, before
+   the translation unit is finished.  */
+
+void
+c_common_write_startup_image (void)
+{
+  static const char partial[IDENT_LENGTH] = "gxsWrite";
+  unsigned char key[16];
+  struct stat st;
+  size_t i;
+  FILE *f;
+
+  if (errorcount || sorrycount)
+    return;
+
+  /* Any declarations of the main file would be restored into every
+     compilation that uses the image.  */
+  if ((cpp_stat_virtual_file (parse_in, main_input_filename, &st)
+       || stat (main_input_filename, &st) == 0)
+      && st.st_size != 0)
+    {
+      error ("%s must be empty to write a startup image",
+             main_input_filename);
+      return;
+    }
+
+  if (!startup_image_key (key))
+    {
+      error ("can%'t find the running executable to write a startup image");
+      return;
+    }
+
+  f = fopen (startup_image_output, "w+b");
+  if (f == NULL)
+    fatal_error ("can%'t create startup image %s: %m", startup_image_output);
+
+  if (fwrite (partial, IDENT_LENGTH, 1, f) != 1
+      || fwrite (key, 16, 1, f) != 1
+      || fwrite (&num_startup_image_files, sizeof (size_t), 1, f) != 1)
+    fatal_error ("can%'t write to %s: %m", startup_image_output);
+
+  for (i = 0; i < num_startup_image_files; i++)
+    {
+      const char *name = startup_image_files[i];
+      size_t len = strlen (name);
+      unsigned char sum[16];
+      off_t size;
+
+      if (!startup_image_file_sum (name, sum, &size))
+        {
+          error ("can%'t write a startup image holding %s", name);
+          fclose (f);
+          unlink (startup_image_output);
+          return;
+        }
+      if (fwrite (&len, sizeof (len), 1, f) != 1
+          || fwrite (name, len, 1, f) != 1
+          || fwrite (&size, sizeof (size), 1, f) != 1
+          || fwrite (sum, 16, 1, f) != 1)
+        fatal_error ("can%'t write to %s: %m", startup_image_output);
+    }
+
+  gt_pch_save (f);
+  cpp_write_pch_state (parse_in, f);
+
+  if (fseek (f, 0, SEEK_SET) != 0
+      || fwrite (startup_image_ident, IDENT_LENGTH, 1, f) != 1)
+    fatal_error ("can%'t write %s: %m", startup_image_output);
+
+  fclose (f);
+}
+
+/* Return true if the files listed in the startup image F are
+   unchanged.  */
+
+static bool
+startup_image_files_valid_p (FILE *f)
+{
+  size_t count, i;
+  bool valid = true;
+  char *name = NULL;
+
+  if (fread (&count, sizeof (count), 1, f) != 1)
+    return false;
+
+  for (i = 0; valid && i < count; i++)
+    {
+      size_t len;
+      off_t size, image_size;
+      unsigned char sum[16], image_sum[16];
+
+      valid = false;
+      if (fread (&len, sizeof (len), 1, f) != 1)
+        break;
+      name = XRESIZEVEC (char, name, len + 1);
+      if (fread (name, len, 1, f) != 1
+          || fread (&image_size, sizeof (image_size), 1, f) != 1
+          || fread (image_sum, 16, 1, f) != 1)
+        break;
+      name[len] = '\0';
+
+      valid = (startup_image_file_sum (name, sum, &size)
+               && size == image_size
+               && memcmp (sum, image_sum, 16) == 0);
+    }
+
+  free (name);
+  return valid;
+}
+
+/* Restore the state in startup_image_file, if there is one and it is
+   valid for this compilation.  This is called by the front end before
+   it builds anything, and it builds nothing that the image holds if
+   this returns true.  */
+
+bool
+c_common_read_startup_image (void)
+{
+  char ident[IDENT_LENGTH];
+  unsigned char key[16], image_key[16];
+  struct save_macro_data *smd;
+  FILE *f;
+
+#ifdef USE_MAPPED_LOCATION
+  /* Locations would refer to the line maps of the run that wrote the
+     image.  */
+  return false;
+#endif
+
+  if (!startup_image_file || startup_image_output || flag_preprocess_only)
+    return false;
+
+  f = fopen (startup_image_file, "rb");
+  if (f == NULL)
+    return false;
+
+  if (fread (ident, IDENT_LENGTH, 1, f) != 1
+      || memcmp (ident, startup_image_ident, IDENT_LENGTH) != 0
+      || fread (image_key, 16, 1, f) != 1
+      || !startup_image_key (key)
+      || memcmp (key, image_key, 16) != 0
+      || !startup_image_files_valid_p (f))
+    {
+      if (cpp_get_options (parse_in)->warn_invalid_pch)
+        warning (0, "%s: startup image is not valid for this compilation",
+                 startup_image_file);
+      fclose (f);
+      return false;
+    }
+
+  /* Build the state normally if the image cannot be placed where it
+     was written, as when address space layout randomization has put
+     something else there.  */
+  cpp_prepare_state (parse_in, &smd);
+  if (!gt_pch_try_restore (f))
+    {
+      if (cpp_get_options (parse_in)->warn_invalid_pch)
+        warning (0, "%s: startup image cannot be placed at its address",
+                 startup_image_file);
+      cpp_discard_state (parse_in, smd);
+      fclose (f);
+      return false;
+    }
+  if (cpp_read_state (parse_in, startup_image_file, f, smd) != 0)
+    fatal_error ("can%'t read startup image %s", startup_image_file);
+
+  fclose (f);
+  startup_image_restored = true;
+  return true;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
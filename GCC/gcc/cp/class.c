@@ -2349,10 +2349,15 @@ check_for_override (tree decl, tree ctype)
        || DECL_CONV_FN_P (decl))
       && look_for_overrides (ctype, decl)
       && !DECL_STATIC_FUNCTION_P (decl))
-    /* Set DECL_VINDEX to a value that is neither an INTEGER_CST nor
-       the error_mark_node so that we know it is an overriding
-       function.  */
-    DECL_VINDEX (decl) = decl;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    {
+      /* Set DECL_VINDEX to a value that is neither an INTEGER_CST nor
+         the error_mark_node so that we know it is an overriding
+         function.  */
+      DECL_VINDEX (decl) = decl;
+      DECL_OVERRIDES_P (decl) = 1;
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (DECL_VIRTUAL_P (decl))
     {
@@ -5189,6 +5194,11 @@ unreverse_member_declarations (tree t)
   TYPE_METHODS (t) = nreverse (TYPE_METHODS (t));
   CLASSTYPE_DECL_LIST (t) = nreverse (CLASSTYPE_DECL_LIST (t));
 
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* The class is about to be laid out.  */
+  forget_member_names (t);
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Actually, for the TYPE_FIELDS, only the non TYPE_DECLs are in
      reverse order, so we can't just use nreverse.  */
   prev = NULL_TREE;
@@ -5443,10 +5453,9 @@ resolves_to_fixed_type_p (tree instance, int* nonnull)
 void
 init_class_processing (void)
 {
-  current_class_depth = 0;
-  current_class_stack_size = 10;
-  current_class_stack
-    = XNEWVEC (struct class_stack_node, current_class_stack_size);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  init_class_stack ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   local_classes = VEC_alloc (tree, gc, 8);
   sizeof_biggest_empty_class = size_zero_node;
 
@@ -5455,6 +5464,20 @@ init_class_processing (void)
   ridpointers[(int) RID_PROTECTED] = access_protected_node;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Allocate the stack of classes being defined, which is not kept in a
+   startup image.  */
+
+void
+init_class_stack (void)
+{
+  current_class_depth = 0;
+  current_class_stack_size = 10;
+  current_class_stack
+    = XNEWVEC (struct class_stack_node, current_class_stack_size);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Restore the cached PREVIOUS_CLASS_LEVEL.  */
 
 static void
@@ -731,6 +731,19 @@ struct cxx_int_tree_map GTY(())
 extern unsigned int cxx_int_tree_map_hash (const void *);
 extern int cxx_int_tree_map_eq (const void *, const void *);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* An entry of the CLASSTYPE_BASE_CACHE of a class: the result of
+   searching its hierarchy for BASE.  */
+
+struct lookup_base_entry GTY(())
+{
+  tree base;
+  tree binfo;
+  int kind;
+  bool want_any;
+};
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Global state pertinent to the current function.  */
 
 struct language_function GTY(())
@@ -1075,6 +1088,11 @@ struct lang_type_class GTY(())
   tree decl_list;
   tree template_info;
   tree befriending_classes;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  tree lazy_members;
+  htab_t GTY ((param_is (struct lookup_base_entry))) base_cache;
+  PTR GTY ((skip)) member_names;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   /* In a RECORD_TYPE, information specific to Objective-C++, such
      as a list of adopted protocols or a pointer to a corresponding
      @interface.  See objc/objc-act.h for details.  */
@@ -1224,6 +1242,38 @@ struct lang_type GTY(())
    and the RECORD_TYPE for the class template otherwise.  */
 #define CLASSTYPE_DECL_LIST(NODE) (LANG_TYPE_CLASS_CHECK (NODE)->decl_list)
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* For a class template instantiation some of whose member functions
+   have not been instantiated yet, a TREE_LIST.  The TREE_PURPOSE is
+   the template arguments to substitute into the pattern.  The
+   TREE_VALUE has one TREE_LIST entry for each member function of the
+   pattern, in order of declaration; the TREE_PURPOSE of an entry is
+   the member of the pattern and the TREE_VALUE is its instantiation,
+   or NULL_TREE if it has not been instantiated yet.  The TREE_CHAIN
+   is a TINST_LEVEL for the point of instantiation of the class.  Those
+   members are instantiated by instantiate_lazy_members when their name
+   is looked up in the class.  */
+#define CLASSTYPE_LAZY_MEMBERS(NODE) \
+  (LANG_TYPE_CLASS_CHECK (NODE)->lazy_members)
+
+/* The results of lookup_base on this class, once it is complete, as
+   a hash table of lookup_base_entry keyed by the base searched for.
+   NULL if no search has been remembered yet.  */
+#define CLASSTYPE_BASE_CACHE(NODE) \
+  (LANG_TYPE_CLASS_CHECK (NODE)->base_cache)
+
+/* While a class with many members is being defined, the set of the
+   names of its TYPE_FIELDS, including those of the members of its
+   anonymous aggregates.  lookup_field_1 uses it to avoid walking the
+   fields for a name that is not there.  NULL if there are few
+   members or the class is complete.  The field is untyped so that
+   gengtype, which skips it, need not know struct pointer_set_t.  */
+#define CLASSTYPE_MEMBER_NAMES(NODE) \
+  ((struct pointer_set_t *) LANG_TYPE_CLASS_CHECK (NODE)->member_names)
+#define SET_CLASSTYPE_MEMBER_NAMES(NODE, VALUE) \
+  (LANG_TYPE_CLASS_CHECK (NODE)->member_names = (VALUE))
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* The slot in the CLASSTYPE_METHOD_VEC where constructors go.  */
 #define CLASSTYPE_CONSTRUCTOR_SLOT 0
 
@@ -1526,7 +1576,9 @@ struct lang_decl_flags GTY(())
   unsigned repo_available_p : 1;
   unsigned hidden_friend_p : 1;
   unsigned threadprivate_p : 1;
-  /* One unused bit.  */
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  unsigned overrides_p : 1;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   union lang_decl_u {
     /* In a FUNCTION_DECL for which DECL_THUNK_P holds, this is
@@ -1891,6 +1943,14 @@ struct lang_decl GTY(())
 #define DECL_PURE_VIRTUAL_P(NODE) \
   (DECL_LANG_SPECIFIC (NODE)->decl_flags.pure_virtual)
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Nonzero for FUNCTION_DECL means that this member function overrides
+   a virtual function of a base class.  Unlike the mark check_for_override
+   leaves in DECL_VINDEX, this survives the layout of the vtables.  */
+#define DECL_OVERRIDES_P(NODE) \
+  (DECL_LANG_SPECIFIC (NODE)->decl_flags.overrides_p)
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* True (in a FUNCTION_DECL) if NODE is a virtual function that is an
    invalid overrider for a function from a base class.  Once we have
    complained about an invalid overrider we avoid complaining about it
@@ -2307,6 +2367,15 @@ extern void decl_shadowed_for_var_insert (tree, tree);
 #define PAREN_STRING_LITERAL_P(NODE) \
   TREE_LANG_FLAG_0 (STRING_CST_CHECK (NODE))
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Nonzero if this STRING_CST holds the values of a brace-enclosed list
+   of integer constants for an array of characters, rather than a
+   string literal.  There is no terminating null, and the type of the
+   elements is that of the array the STRING_CST initializes.  */
+#define INITIALIZER_LIST_STRING_P(NODE) \
+  TREE_LANG_FLAG_1 (STRING_CST_CHECK (NODE))
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Nonzero if this AGGR_INIT_EXPR provides for initialization via a
    constructor call, rather than an ordinary function call.  */
 #define AGGR_INIT_VIA_CTOR_P(NODE) \
@@ -3822,6 +3891,9 @@ extern tree finish_struct                        (tree, tree);
 extern void finish_struct_1                        (tree);
 extern int resolves_to_fixed_type_p                (tree, int *);
 extern void init_class_processing                (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void init_class_stack                    (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern int is_empty_class                        (tree);
 extern void pushclass                                (tree);
 extern void popclass                                (void);
@@ -3876,6 +3948,9 @@ extern void insert_block                        (tree);
 extern tree pushdecl                                (tree);
 extern tree pushdecl_maybe_friend                (tree, bool);
 extern void cxx_init_decl_processing                (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void cxx_init_decl_processing_from_image (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 enum cp_tree_node_structure_enum cp_tree_node_structure
                                                 (union lang_tree_node *);
 extern bool cxx_mark_addressable                (tree);
@@ -3889,6 +3964,9 @@ extern tree pushtag                                (tree, tree, tag_scope);
 extern tree make_anon_name                        (void);
 extern int decls_match                                (tree, tree);
 extern tree duplicate_decls                        (tree, tree, bool);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void print_decl_statistics                (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern tree pushdecl_top_level_maybe_friend        (tree, bool);
 extern tree pushdecl_top_level_and_finish        (tree, tree);
 extern tree declare_local_label                        (tree);
@@ -4021,6 +4099,9 @@ extern void print_instantiation_context                (void);
 
 /* in except.c */
 extern void init_exception_processing                (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void init_exception_hooks                (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern tree expand_start_catch_block                (tree);
 extern void expand_end_catch_block                (void);
 extern tree build_exc_ptr                        (void);
@@ -4094,6 +4175,11 @@ extern tree make_alias_for                        (tree, tree);
 /* In optimize.c */
 extern bool maybe_clone_body                        (tree);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* in parser.c */
+extern void print_parser_statistics                (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* in pt.c */
 extern void check_template_shadow                (tree);
 extern tree get_innermost_template_args                (tree, int);
@@ -4144,6 +4230,11 @@ extern tree get_mostly_instantiated_function_type (tree);
 extern int problematic_instantiation_changed        (void);
 extern void record_last_problematic_instantiation (void);
 extern tree current_instantiation                (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void print_template_statistics                (void);
+extern void print_template_report                (void);
+extern void instantiate_lazy_members                (tree, tree);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern tree maybe_get_template_decl_from_type_decl (tree);
 extern int processing_template_parmlist;
 extern bool dependent_type_p                        (tree);
@@ -4187,6 +4278,10 @@ extern tree lookup_base                                (tree, tree, base_access,
 extern tree dcast_base_hint                        (tree, tree);
 extern int accessible_p                                (tree, tree, bool);
 extern tree lookup_field_1                        (tree, tree, bool);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void note_member_name                        (tree, tree);
+extern void forget_member_names                        (tree);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern tree lookup_field                        (tree, tree, int, bool);
 extern int lookup_fnfields_1                        (tree, tree);
 extern int class_method_index_for_fn                (tree, tree);
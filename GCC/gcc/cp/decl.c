@@ -1095,6 +1095,102 @@ check_redeclaration_exception_specification (tree new_decl,
     }
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Statistics reported by print_decl_statistics.  */
+static int n_redeclarations_merged;
+static int n_redeclarations_identical;
+static long redeclaration_merge_time;
+
+/* Return true if NEWDECL, a redeclaration of OLDDECL, says nothing
+   OLDDECL does not say already: a namespace-scope function
+   declaration that is not a definition, has the same type node,
+   linkage, storage class and attributes, and repeats no default
+   arguments.  Merging such a declaration changes nothing but the
+   location of OLDDECL.  */
+
+static bool
+identical_redeclaration_p (tree newdecl, tree olddecl,
+                           bool newdecl_is_friend)
+{
+  tree parm;
+
+  if (TREE_CODE (newdecl) != FUNCTION_DECL
+      || TREE_CODE (olddecl) != FUNCTION_DECL
+      || TREE_TYPE (newdecl) != TREE_TYPE (olddecl)
+      || !DECL_LANG_SPECIFIC (newdecl)
+      || !DECL_LANG_SPECIFIC (olddecl))
+    return false;
+
+  /* Built-ins, friends and templates need the full merge.  */
+  if (newdecl_is_friend
+      || DECL_ARTIFICIAL (newdecl)
+      || DECL_ARTIFICIAL (olddecl)
+      || DECL_ANTICIPATED (olddecl)
+      || DECL_FRIEND_P (olddecl)
+      || DECL_TEMPLATE_INFO (newdecl)
+      || DECL_TEMPLATE_INFO (olddecl)
+      || DECL_USE_TEMPLATE (newdecl)
+      || DECL_USE_TEMPLATE (olddecl))
+    return false;
+
+  if (!DECL_NAMESPACE_SCOPE_P (newdecl)
+      || CP_DECL_CONTEXT (newdecl) != CP_DECL_CONTEXT (olddecl)
+      || DECL_LOCAL_FUNCTION_P (newdecl)
+      || DECL_LOCAL_FUNCTION_P (olddecl)
+      || DECL_LANGUAGE (newdecl) != DECL_LANGUAGE (olddecl))
+    return false;
+
+  if (DECL_INITIAL (newdecl)
+      || DECL_INLINE (newdecl)
+      || DECL_DECLARED_INLINE_P (newdecl)
+      || TREE_PUBLIC (newdecl) != TREE_PUBLIC (olddecl)
+      || DECL_EXTERNAL (newdecl) != DECL_EXTERNAL (olddecl)
+      || DECL_THIS_EXTERN (newdecl) != DECL_THIS_EXTERN (olddecl)
+      || DECL_THIS_STATIC (newdecl) != DECL_THIS_STATIC (olddecl)
+      || (TREE_STATIC (newdecl) && !TREE_STATIC (olddecl))
+      || (DECL_WEAK (newdecl) && !DECL_WEAK (olddecl))
+      || DECL_VISIBILITY_SPECIFIED (newdecl)
+      || DECL_SECTION_NAME (newdecl))
+    return false;
+
+  if (DECL_ATTRIBUTES (newdecl)
+      && !attribute_list_equal (DECL_ATTRIBUTES (newdecl),
+                                DECL_ATTRIBUTES (olddecl)))
+    return false;
+
+  /* The full merge keeps the parameters of OLDDECL, if it has any.  */
+  if (DECL_ARGUMENTS (newdecl) && !DECL_ARGUMENTS (olddecl))
+    return false;
+
+  /* Default arguments given again are diagnosed by the full merge.  */
+  for (parm = TYPE_ARG_TYPES (TREE_TYPE (newdecl));
+       parm; parm = TREE_CHAIN (parm))
+    if (TREE_PURPOSE (parm))
+      return false;
+
+  return !warn_redundant_decls;
+}
+
+/* Print statistics about redeclarations for -fmem-report.  */
+
+void
+print_decl_statistics (void)
+{
+  fprintf (stderr, "%d redeclarations merged in %ld ms, "
+           "%d identical ones skipped",
+           n_redeclarations_merged, redeclaration_merge_time / 1000,
+           n_redeclarations_identical);
+  if (n_redeclarations_merged)
+    fprintf (stderr, " (about %ld ms saved)",
+             (long) ((double) redeclaration_merge_time
+                     / n_redeclarations_merged
+                     * n_redeclarations_identical / 1000));
+  fprintf (stderr, "\n");
+}
+
+static tree merge_duplicate_decls (tree, tree, bool);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* If NEWDECL is a redeclaration of OLDDECL, merge the declarations.
    If the redeclaration is invalid, a diagnostic is issued, and the
    error_mark_node is returned.  Otherwise, OLDDECL is returned.
@@ -1107,6 +1203,46 @@ check_redeclaration_exception_specification (tree new_decl,
 tree
 duplicate_decls (tree newdecl, tree olddecl, bool newdecl_is_friend)
 {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  tree result;
+  long start = 0;
+
+  if (newdecl == olddecl)
+    return olddecl;
+
+  if (identical_redeclaration_p (newdecl, olddecl, newdecl_is_friend))
+    {
+      /* As the full merge would, move OLDDECL to the latest
+         declaration unless it has been defined.  */
+      if (DECL_INITIAL (olddecl) == NULL_TREE)
+        DECL_SOURCE_LOCATION (olddecl) = DECL_SOURCE_LOCATION (newdecl);
+      DECL_IN_SYSTEM_HEADER (olddecl) = DECL_IN_SYSTEM_HEADER (newdecl);
+
+      ++n_redeclarations_identical;
+      ggc_free (DECL_LANG_SPECIFIC (newdecl));
+      ggc_free (newdecl);
+      return olddecl;
+    }
+
+  if (mem_report)
+    start = get_run_time ();
+  result = merge_duplicate_decls (newdecl, olddecl, newdecl_is_friend);
+  if (result && result != error_mark_node)
+    {
+      ++n_redeclarations_merged;
+      if (mem_report)
+        redeclaration_merge_time += get_run_time () - start;
+    }
+  return result;
+}
+
+/* Merge NEWDECL into OLDDECL as described for duplicate_decls, which
+   has already dealt with identical redeclarations.  */
+
+static tree
+merge_duplicate_decls (tree newdecl, tree olddecl, bool newdecl_is_friend)
+{
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   unsigned olddecl_uid = DECL_UID (olddecl);
   int olddecl_friend = 0, types_match = 0, hidden_friend = 0;
   int new_defines_function = 0;
@@ -1227,8 +1363,8 @@ duplicate_decls (tree newdecl, tree olddecl, bool newdecl_is_friend)
                           = TYPE_ARG_TYPES (TREE_TYPE (newdecl));
                         types_match = decls_match (newdecl, olddecl);
                         if (types_match)
-                          return duplicate_decls (newdecl, olddecl,
-                                                  newdecl_is_friend);
+                          return merge_duplicate_decls (newdecl, olddecl,
+                                                        newdecl_is_friend);
                         TYPE_ARG_TYPES (TREE_TYPE (olddecl)) = oldargs;
                       }
                   }
@@ -3117,6 +3253,30 @@ initialize_predefined_identifiers (void)
     }
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Adjust various flags based on command-line settings.  */
+
+static void
+adjust_decl_processing_flags (void)
+{
+  if (!flag_permissive)
+    flag_pedantic_errors = 1;
+  if (!flag_no_inline)
+    {
+      flag_inline_trees = 1;
+      flag_no_inline = 1;
+    }
+  if (flag_inline_functions)
+    flag_inline_trees = 2;
+
+  /* Force minimum function alignment if using the least significant
+     bit of function pointers to store the virtual bit.  */
+  if (TARGET_PTRMEMFUNC_VBIT_LOCATION == ptrmemfunc_vbit_in_pfn
+      && force_align_functions_log < 1)
+    force_align_functions_log = 1;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Create the predefined scalar types of C,
    and some nodes representing standard constants (0, 1, (void *)0).
    Initialize the global binding level.
@@ -3147,22 +3307,9 @@ cxx_init_decl_processing (void)
 
   current_lang_name = NULL_TREE;
 
-  /* Adjust various flags based on command-line settings.  */
-  if (!flag_permissive)
-    flag_pedantic_errors = 1;
-  if (!flag_no_inline)
-    {
-      flag_inline_trees = 1;
-      flag_no_inline = 1;
-    }
-  if (flag_inline_functions)
-    flag_inline_trees = 2;
-
-  /* Force minimum function alignment if using the least significant
-     bit of function pointers to store the virtual bit.  */
-  if (TARGET_PTRMEMFUNC_VBIT_LOCATION == ptrmemfunc_vbit_in_pfn
-      && force_align_functions_log < 1)
-    force_align_functions_log = 1;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  adjust_decl_processing_flags ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Initially, C.  */
   current_lang_name = lang_name_c;
@@ -3306,6 +3453,31 @@ cxx_init_decl_processing (void)
     using_eh_for_cleanups ();
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Do the part of cxx_init_decl_processing that a restored startup
+   image does not hold: the flags and hooks outside the
+   garbage-collected heap.  */
+
+void
+cxx_init_decl_processing_from_image (void)
+{
+  adjust_decl_processing_flags ();
+  init_class_stack ();
+
+  if (flag_exceptions)
+    init_exception_hooks ();
+
+  if (! supports_one_only ())
+    flag_weak = 0;
+
+  make_fname_decl = cp_make_fname_decl;
+
+  /* Show we use EH for cleanups.  */
+  if (flag_exceptions)
+    using_eh_for_cleanups ();
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Generate an initializer for a function naming variable from
    NAME. NAME may be NULL, to indicate a dependent name.  TYPE_P is
    filled in with the type of the init.  */
@@ -4466,6 +4638,63 @@ reshape_init_array_1 (tree elt_type, tree max_index, reshape_iter *d)
   return new_init;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Subroutine of reshape_init_array.  If the initializers for an array
+   of ELT_TYPE, a character type, are all integer constants that the
+   type can represent, return a STRING_CST of their values marked with
+   INITIALIZER_LIST_STRING_P, which digest_init takes like a string
+   literal.  Otherwise return NULL_TREE without consuming anything.
+   Generated data tables hold millions of such initializers, and the
+   string costs a byte for each where the CONSTRUCTOR costs a node.  */
+
+static tree
+reshape_init_char_array (tree elt_type, tree max_index, reshape_iter *d)
+{
+  constructor_elt *ce;
+  unsigned HOST_WIDE_INT len;
+  unsigned HOST_WIDE_INT i;
+  char *bytes;
+  tree str;
+
+  if (TYPE_PRECISION (elt_type) != BITS_PER_UNIT
+      || !char_type_p (TYPE_MAIN_VARIANT (elt_type)))
+    return NULL_TREE;
+
+  len = d->end - d->cur;
+  if (max_index)
+    {
+      if (!host_integerp (max_index, 1)
+          || integer_all_onesp (max_index))
+        return NULL_TREE;
+      if (len > tree_low_cst (max_index, 1) + 1)
+        len = tree_low_cst (max_index, 1) + 1;
+    }
+  if (len == 0)
+    return NULL_TREE;
+
+  for (ce = d->cur; ce != d->cur + len; ++ce)
+    if (ce->index
+        || TREE_CODE (ce->value) != INTEGER_CST
+        || TREE_OVERFLOW (ce->value)
+        || !INTEGRAL_TYPE_P (TREE_TYPE (ce->value))
+        || !int_fits_type_p (ce->value, elt_type))
+      return NULL_TREE;
+
+  bytes = XNEWVEC (char, len);
+  for (i = 0; i < len; ++i)
+    bytes[i] = (char) TREE_INT_CST_LOW (d->cur[i].value);
+  str = build_string (len, bytes);
+  free (bytes);
+
+  TREE_TYPE (str) = build_cplus_array_type (char_type_node,
+                                            build_index_type
+                                            (size_int (len - 1)));
+  INITIALIZER_LIST_STRING_P (str) = 1;
+  d->cur += len;
+  return str;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Subroutine of reshape_init_r, processes the initializers for arrays.
    Parameters are the same of reshape_init_r.  */
 
@@ -4473,12 +4702,21 @@ static tree
 reshape_init_array (tree type, reshape_iter *d)
 {
   tree max_index = NULL_TREE;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  tree str;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   gcc_assert (TREE_CODE (type) == ARRAY_TYPE);
 
   if (TYPE_DOMAIN (type))
     max_index = array_type_nelts (type);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  str = reshape_init_char_array (TREE_TYPE (type), max_index, d);
+  if (str)
+    return str;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   return reshape_init_array_1 (TREE_TYPE (type), max_index, d);
 }
 
@@ -10292,11 +10530,18 @@ finish_enum (tree enumtype)
       location_t saved_location;
 
       decl = TREE_VALUE (values);
-      saved_location = input_location;
-      input_location = DECL_SOURCE_LOCATION (decl);
-      value = perform_implicit_conversion (underlying_type,
-                                           DECL_INITIAL (decl));
-      input_location = saved_location;
+      /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* Most enumerators already have the underlying type; there is
+         nothing to convert for them.  */
+      value = DECL_INITIAL (decl);
+      if (TREE_TYPE (value) != underlying_type)
+        {
+          saved_location = input_location;
+          input_location = DECL_SOURCE_LOCATION (decl);
+          value = perform_implicit_conversion (underlying_type, value);
+          input_location = saved_location;
+        }
+      /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       /* Do not clobber shared ints.  */
       value = copy_node (value);
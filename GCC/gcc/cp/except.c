@@ -85,6 +85,18 @@ init_exception_processing (void)
   else
     default_init_unwind_resume_libfunc ();
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  init_exception_hooks ();
+}
+
+/* Point the language-independent exception handling code at the C++
+   hooks.  Unlike the declarations init_exception_processing builds,
+   these are not kept in a startup image.  */
+
+void
+init_exception_hooks (void)
+{
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   lang_eh_runtime_type = build_eh_type_type;
   lang_protect_cleanup_actions = &cp_protect_cleanup_actions;
 }
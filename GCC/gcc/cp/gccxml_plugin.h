@@ -0,0 +1,148 @@
+/* gccxml_cc1plus - A GCC parser patched for XML dumps of translation units
+   Copyright (C) 2002-2007 Kitware, Inc., Insight Consortium
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the
+
+  Free Software Foundation, Inc.
+  51 Franklin Street, Fifth Floor
+  Boston, MA  02110-1301  USA
+
+*/
+
+/* Interface for in-process consumers of the XML dump.
+
+   A consumer is a shared library named with -fxml-plugin=<library>.
+   gccxml_cc1plus loads it after a translation unit has been parsed
+   without errors and calls its GCCXML_PLUGIN_INIT_SYMBOL function.
+   That function fills in a gccxml_plugin structure whose callbacks
+   then receive every element of the dump, in the same order and
+   with the same attributes as the XML file would contain.  No text
+   is formatted for a consumer unless -fxml=<file> is also given.
+
+   The strings and structures passed to a callback are owned by
+   gccxml_cc1plus.  An element and everything it refers to remain
+   valid from its start_element call until its end_element call, so
+   the parent chain of an element may be inspected from its children.
+   Copy anything that must live longer.
+
+   This header has no dependencies on the GCC sources and may be
+   included from C or C++.  */
+
+#ifndef GCCXML_PLUGIN_H
+#define GCCXML_PLUGIN_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped whenever the structures below change incompatibly.  */
+#define GCCXML_PLUGIN_API_VERSION 1
+
+/* Name of the function every consumer library must export.  */
+#define GCCXML_PLUGIN_INIT_SYMBOL "gccxml_plugin_init"
+
+/* A string that is not necessarily null-terminated.  */
+typedef struct gccxml_string
+{
+  const char* data;
+  size_t length;
+} gccxml_string;
+
+/* How an attribute value should be interpreted.  */
+typedef enum gccxml_value_kind
+{
+  /* The identifier of this element, such as "_42" or "f1".  */
+  gccxml_value_id,
+
+  /* The identifier of another element.  A reference to a type may
+     carry the suffixes "c", "v" and "r"; it then names the
+     CvQualifiedType element with that identifier.  */
+  gccxml_value_idref,
+
+  /* A space-separated list of element identifiers.  The "bases" list
+     prefixes non-public bases with "protected:" or "private:".  */
+  gccxml_value_idrefs,
+
+  /* Any other value: names, numbers, flags and expressions.  */
+  gccxml_value_string
+} gccxml_value_kind;
+
+/* One attribute of an element.  The value has had XML escaping
+   removed.  */
+typedef struct gccxml_attribute
+{
+  gccxml_string name;
+  gccxml_string value;
+  gccxml_value_kind kind;
+} gccxml_attribute;
+
+/* One element of the dump.  */
+typedef struct gccxml_element
+{
+  /* The element name, such as "Class" or "Argument".  */
+  gccxml_string kind;
+
+  /* Values of the "id" and "name" attributes, or empty strings.  */
+  gccxml_string id;
+  gccxml_string name;
+
+  /* The enclosing element, or NULL for the GCC_XML document element.
+     Declarations and types have depth 1, their arguments, bases and
+     enumeration values depth 2.  */
+  const struct gccxml_element* parent;
+  unsigned int depth;
+
+  /* All attributes in document order, including "id" and "name".  */
+  const gccxml_attribute* attributes;
+  unsigned int num_attributes;
+} gccxml_element;
+
+/* Callbacks filled in by the consumer's init function.  Any callback
+   may be NULL.  */
+typedef struct gccxml_plugin
+{
+  /* Must be set to GCCXML_PLUGIN_API_VERSION.  */
+  unsigned int api_version;
+
+  /* Passed unchanged to every callback.  */
+  void* data;
+
+  /* Called once all attributes of an element are known, before any
+     of its nested elements.  */
+  void (*start_element) (void* data, const gccxml_element* element);
+
+  /* Called after the last nested element, or right after
+     start_element for an element without content.  */
+  void (*end_element) (void* data, const gccxml_element* element);
+
+  /* Called after the document element has ended, before the library
+     is unloaded.  */
+  void (*finish) (void* data);
+} gccxml_plugin;
+
+/* Type of GCCXML_PLUGIN_INIT_SYMBOL.  API_VERSION is the version
+   gccxml_cc1plus was built with and ARG is the -fxml-plugin-arg=
+   value, or NULL.  Return zero on success; any other value aborts the
+   dump with an error.  */
+typedef int (*gccxml_plugin_init_function) (unsigned int api_version,
+                                            const char* arg,
+                                            gccxml_plugin* plugin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
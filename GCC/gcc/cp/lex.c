@@ -86,6 +86,9 @@ void
 cxx_finish (void)
 {
   c_common_finish ();
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  print_template_report ();
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* A mapping from tree codes to operator name information.  */
@@ -372,6 +375,22 @@ cxx_init (void)
   push_srcloc ("<built-in>", 0);
 #endif
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* A startup image holds the identifiers and the global declarations
+     built below, so only the state outside the garbage-collected heap
+     is set up when one is restored.  */
+  if (c_common_read_startup_image ())
+    {
+      init_method ();
+      init_error ();
+
+      current_function_decl = NULL;
+
+      cxx_init_decl_processing_from_image ();
+    }
+  else
+    {
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   init_reswords ();
   init_tree ();
   init_cp_semantics ();
@@ -384,6 +403,9 @@ cxx_init (void)
   class_type_node = ridpointers[(int) RID_CLASS];
 
   cxx_init_decl_processing ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* The fact that G++ uses COMDAT for many entities (inline
      functions, template instantiations, virtual tables, etc.) mean
@@ -767,6 +789,15 @@ copy_lang_type (tree node)
   lt = GGC_NEWVAR (struct lang_type, size);
   memcpy (lt, TYPE_LANG_SPECIFIC (node), size);
   TYPE_LANG_SPECIFIC (node) = lt;
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* The base searches remembered for NODE do not apply to the copy,
+     and the member names of NODE are not kept up to date for it.  */
+  if (lt->u.h.is_lang_type_class)
+    {
+      lt->u.c.base_cache = NULL;
+      lt->u.c.member_names = NULL;
+    }
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifdef GATHER_STATISTICS
   tree_node_counts[(int)lang_type] += 1;
@@ -1821,9 +1821,19 @@ push_using_decl (tree scope, tree name)
   timevar_push (TV_NAME_LOOKUP);
   gcc_assert (TREE_CODE (scope) == NAMESPACE_DECL);
   gcc_assert (TREE_CODE (name) == IDENTIFIER_NODE);
-  for (decl = current_binding_level->usings; decl; decl = TREE_CHAIN (decl))
-    if (USING_DECL_SCOPE (decl) == scope && DECL_NAME (decl) == name)
-      break;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* In namespace scope a redeclaration is returned like a new one, so
+     do not search the list.  A namespace may hold many thousands of
+     using-declarations, and searching made each one cost time
+     proportional to the number before it.  */
+  if (namespace_bindings_p ())
+    decl = NULL_TREE;
+  else
+    for (decl = current_binding_level->usings; decl;
+         decl = TREE_CHAIN (decl))
+      if (USING_DECL_SCOPE (decl) == scope && DECL_NAME (decl) == name)
+        break;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (decl)
     POP_TIMEVAR_AND_RETURN (TV_NAME_LOOKUP,
                             namespace_bindings_p () ? decl : NULL_TREE);
@@ -59,7 +59,30 @@ struct tree_check GTY(())
   tree qualifying_scope;
 };
 
-/* A C++ token.  */
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The source position at which a token was found.  All the tokens of
+   a line share one of these, so a token refers to its position by an
+   index into cp_token_sources instead of holding it.  */
+
+typedef struct cp_token_source GTY (())
+{
+  /* The location at which the tokens were found.  */
+  location_t location;
+  /* The input file stack index at which the tokens were found.  */
+  unsigned input_file_stack_index : INPUT_FILE_STACK_BITS;
+  /* True if the tokens are from a system header.  */
+  BOOL_BITFIELD in_system_header : 1;
+} cp_token_source;
+
+DEF_VEC_O (cp_token_source);
+DEF_VEC_ALLOC_O (cp_token_source,heap);
+
+/* The positions of all the tokens lexed so far.  The first entry is
+   an unknown location, used by the EOF token and by purged tokens.  */
+static VEC(cp_token_source,heap) *cp_token_sources;
+
+/* A C++ token.  The main lexer holds every token of the translation
+   unit, so this is kept to 16 bytes on a 64-bit host.  */
 
 typedef struct cp_token GTY (())
 {
@@ -72,27 +95,55 @@ typedef struct cp_token GTY (())
   unsigned char flags;
   /* Identifier for the pragma.  */
   ENUM_BITFIELD (pragma_kind) pragma_kind : 6;
-  /* True if this token is from a system header.  */
-  BOOL_BITFIELD in_system_header : 1;
   /* True if this token is from a context where it is implicitly extern "C" */
   BOOL_BITFIELD implicit_extern_c : 1;
   /* True for a CPP_NAME token that is not a keyword (i.e., for which
      KEYWORD is RID_MAX) iff this name was looked up and found to be
      ambiguous.  An error has already been reported.  */
   BOOL_BITFIELD ambiguous_p : 1;
-  /* The input file stack index at which this token was found.  */
-  unsigned input_file_stack_index : INPUT_FILE_STACK_BITS;
-  /* The value associated with this token, if any.  */
+  /* The index in cp_token_sources of the position at which this token
+     was found.  Use cp_token_location and cp_token_in_system_header
+     to get at it.  */
+  unsigned source;
+  /* The value associated with this token, if any.  Values other than
+     an identifier or a constant are kept in a separate tree_check.  */
   union cp_token_value {
     /* Used for CPP_NESTED_NAME_SPECIFIER and CPP_TEMPLATE_ID.  */
     struct tree_check* GTY((tag ("1"))) tree_check_value;
     /* Use for all other tokens.  */
     tree GTY((tag ("0"))) value;
   } GTY((desc ("(%1.type == CPP_TEMPLATE_ID) || (%1.type == CPP_NESTED_NAME_SPECIFIER)"))) u;
-  /* The location at which this token was found.  */
-  location_t location;
 } cp_token;
 
+/* Statistics reported by print_parser_statistics.  */
+static unsigned long n_tokens_lexed;
+static unsigned long n_token_sources;
+
+/* Return the position at which TOKEN was found.  */
+
+static inline cp_token_source *
+cp_token_source_of (const cp_token *token)
+{
+  return VEC_index (cp_token_source, cp_token_sources, token->source);
+}
+
+/* Return the location at which TOKEN was found.  */
+
+static inline location_t
+cp_token_location (const cp_token *token)
+{
+  return cp_token_source_of (token)->location;
+}
+
+/* Return true if TOKEN is from a system header.  */
+
+static inline bool
+cp_token_in_system_header (const cp_token *token)
+{
+  return cp_token_source_of (token)->in_system_header;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* We use a stack of token pointer for saving token sets.  */
 typedef struct cp_token *cp_token_position;
 DEF_VEC_P (cp_token_position);
@@ -100,12 +151,9 @@ DEF_VEC_ALLOC_P (cp_token_position,heap);
 
 static const cp_token eof_token =
 {
-  CPP_EOF, RID_MAX, 0, PRAGMA_NONE, 0, 0, false, 0, { NULL },
-#if USE_MAPPED_LOCATION
-  0
-#else
-  {0, 0}
-#endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  CPP_EOF, RID_MAX, 0, PRAGMA_NONE, 0, false, 0, { NULL }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 };
 
 /* The cp_lexer structure represents the C++ lexer.  It is responsible
@@ -178,6 +226,10 @@ static cp_token *cp_lexer_token_at
   (cp_lexer *, cp_token_position);
 static void cp_lexer_get_preprocessor_token
   (cp_lexer *, cp_token *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static unsigned cp_lexer_token_source
+  (location_t);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 static inline cp_token *cp_lexer_peek_token
   (cp_lexer *);
 static cp_token *cp_lexer_peek_nth_token
@@ -319,6 +371,10 @@ cp_lexer_new_main (void)
   lexer->buffer_length = alloc - space;
   lexer->last_token = pos;
   lexer->next_token = lexer->buffer_length ? buffer : (cp_token *)&eof_token;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  n_tokens_lexed = lexer->buffer_length;
+  n_token_sources = VEC_length (cp_token_source, cp_token_sources);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Subsequent preprocessor diagnostics should use compiler
      diagnostic functions to get the compiler source location.  */
@@ -363,7 +419,13 @@ static void
 cp_lexer_destroy (cp_lexer *lexer)
 {
   if (lexer->buffer)
-    ggc_free (lexer->buffer);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    {
+      /* The positions die with the tokens of the main lexer.  */
+      ggc_free (lexer->buffer);
+      VEC_free (cp_token_source, heap, cp_token_sources);
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   VEC_free (cp_token_position, heap, lexer->saved_tokens);
   ggc_free (lexer);
 }
@@ -402,6 +464,44 @@ cp_lexer_saving_tokens (const cp_lexer* lexer)
   return VEC_length (cp_token_position, lexer->saved_tokens) != 0;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the index in cp_token_sources of the current input position,
+   found at LOCATION.  The previous token's entry is reused when
+   nothing has changed since it was lexed.  */
+
+static unsigned
+cp_lexer_token_source (location_t location)
+{
+  cp_token_source *last;
+  cp_token_source *source;
+
+  if (!cp_token_sources)
+    {
+      /* The unknown location of the EOF and purged tokens.  */
+      source = VEC_safe_push (cp_token_source, heap, cp_token_sources, NULL);
+      memset (source, 0, sizeof (*source));
+      source->location = UNKNOWN_LOCATION;
+    }
+
+  last = VEC_last (cp_token_source, cp_token_sources);
+#if USE_MAPPED_LOCATION
+  if (last->location == location
+#else
+  if (last->location.line == location.line
+      && last->location.file == location.file
+#endif
+      && last->input_file_stack_index == input_file_stack_tick
+      && last->in_system_header == (in_system_header != 0))
+    return VEC_length (cp_token_source, cp_token_sources) - 1;
+
+  source = VEC_safe_push (cp_token_source, heap, cp_token_sources, NULL);
+  source->location = location;
+  source->input_file_stack_index = input_file_stack_tick;
+  source->in_system_header = in_system_header != 0;
+  return VEC_length (cp_token_source, cp_token_sources) - 1;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Store the next token from the preprocessor in *TOKEN.  Return true
    if we reach EOF.  */
 
@@ -410,14 +510,16 @@ cp_lexer_get_preprocessor_token (cp_lexer *lexer ATTRIBUTE_UNUSED ,
                                  cp_token *token)
 {
   static int is_extern_c = 0;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  location_t location;
 
    /* Get a new token from the preprocessor.  */
   token->type
-    = c_lex_with_flags (&token->u.value, &token->location, &token->flags);
-  token->input_file_stack_index = input_file_stack_tick;
+    = c_lex_with_flags (&token->u.value, &location, &token->flags);
+  token->source = cp_lexer_token_source (location);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   token->keyword = RID_MAX;
   token->pragma_kind = PRAGMA_NONE;
-  token->in_system_header = in_system_header;
 
   /* On some systems, some header files are surrounded by an
      implicit extern "C" block.  Set a flag in the token if it
@@ -479,9 +581,12 @@ cp_lexer_set_source_position_from_token (cp_token *token)
 {
   if (token->type != CPP_EOF)
     {
-      input_location = token->location;
-      in_system_header = token->in_system_header;
-      restore_input_file_stack (token->input_file_stack_index);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      cp_token_source *source = cp_token_source_of (token);
+      input_location = source->location;
+      in_system_header = source->in_system_header;
+      restore_input_file_stack (source->input_file_stack_index);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
     }
 }
 
@@ -659,7 +764,9 @@ cp_lexer_purge_token (cp_lexer *lexer)
 
   gcc_assert (tok != &eof_token);
   tok->type = CPP_PURGED;
-  tok->location = UNKNOWN_LOCATION;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  tok->source = 0;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   tok->u.value = NULL_TREE;
   tok->keyword = RID_MAX;
 
@@ -693,7 +800,9 @@ cp_lexer_purge_tokens_after (cp_lexer *lexer, cp_token *tok)
   for ( tok += 1; tok != peek; tok += 1)
     {
       tok->type = CPP_PURGED;
-      tok->location = UNKNOWN_LOCATION;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      tok->source = 0;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
       tok->u.value = NULL_TREE;
       tok->keyword = RID_MAX;
     }
@@ -2859,6 +2968,16 @@ cp_parser_translation_unit (cp_parser* parser)
           parser->implicit_extern_c = false;
         }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* Save the state built from the -include files before the
+         translation unit is finished.  */
+      if (startup_image_output)
+        c_common_write_startup_image ();
+
+      /* Nothing more is lexed.  */
+      cpp_release_parse_memory (parse_in);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
       /* Finish up.  */
       finish_translation_unit ();
 
@@ -6238,7 +6357,9 @@ cp_parser_statement (cp_parser* parser, tree in_statement_expr,
   /* Peek at the next token.  */
   token = cp_lexer_peek_token (parser->lexer);
   /* Remember the location of the first token in the statement.  */
-  statement_location = token->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  statement_location = cp_token_location (token);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   /* If this is a keyword, then that will often determine what kind of
      statement we have.  */
   if (token->type == CPP_KEYWORD)
@@ -11860,7 +11981,9 @@ cp_parser_direct_declarator (cp_parser* parser,
           declarator = make_id_declarator (qualifying_scope,
                                            unqualified_name,
                                            sfk);
-          declarator->id_loc = token->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+          declarator->id_loc = cp_token_location (token);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
         handle_declarator:;
           scope = get_scope_of_declarator (declarator);
@@ -12829,6 +12952,52 @@ cp_parser_initializer_clause (cp_parser* parser, bool* non_constant_p)
   return initializer;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the number of initializer-clauses at the start of the rest
+   of an initializer-list that are each a single integer or character
+   literal, such as the long runs of a generated data table.  Such a
+   clause is its own value, so the caller can take the literals
+   without parsing them as expressions.  */
+
+static size_t
+cp_parser_literal_initializer_run (cp_parser* parser)
+{
+  cp_lexer *lexer = parser->lexer;
+  cp_token *token = lexer->next_token;
+  size_t run = 0;
+
+  while (token != &eof_token)
+    {
+      cp_token *next;
+
+      if ((token->type != CPP_NUMBER && token->type != CPP_CHAR)
+          || TREE_CODE (token->u.value) != INTEGER_CST)
+        break;
+
+      /* The literal must be followed by a `,' or the closing `}'.  */
+      next = token + 1;
+      while (next != lexer->last_token && next->type == CPP_PURGED)
+        ++next;
+      if (next == lexer->last_token
+          || (next->type != CPP_COMMA && next->type != CPP_CLOSE_BRACE))
+        break;
+
+      ++run;
+      if (next->type == CPP_CLOSE_BRACE)
+        break;
+
+      /* Move to the clause after the `,'.  */
+      token = next + 1;
+      while (token != lexer->last_token && token->type == CPP_PURGED)
+        ++token;
+      if (token == lexer->last_token)
+        break;
+    }
+
+  return run;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Parse an initializer-list.
 
    initializer-list:
@@ -12861,6 +13030,9 @@ cp_parser_initializer_list (cp_parser* parser, bool* non_constant_p)
       tree identifier;
       tree initializer;
       bool clause_non_constant_p;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      size_t run;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       /* If the next token is an identifier and the following one is a
          colon, we are looking at the GNU designated-initializer
@@ -12880,6 +13052,25 @@ cp_parser_initializer_list (cp_parser* parser, bool* non_constant_p)
       else
         identifier = NULL_TREE;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* Take a run of literals, which are all constant, at once.  The
+         `,' after the last one is left for the check below.  */
+      if (!identifier
+          && (run = cp_parser_literal_initializer_run (parser)) != 0)
+        {
+          VEC_reserve (constructor_elt, gc, v, run);
+          for (;;)
+            {
+              initializer = cp_lexer_consume_token (parser->lexer)->u.value;
+              CONSTRUCTOR_APPEND_ELT (v, NULL_TREE, initializer);
+              if (--run == 0)
+                break;
+              cp_lexer_consume_token (parser->lexer);
+            }
+        }
+      else
+        {
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
       /* Parse the initializer.  */
       initializer = cp_parser_initializer_clause (parser,
                                                   &clause_non_constant_p);
@@ -12889,6 +13080,9 @@ cp_parser_initializer_list (cp_parser* parser, bool* non_constant_p)
 
       /* Add it to the vector.  */
       CONSTRUCTOR_APPEND_ELT(v, identifier, initializer);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+        }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       /* If the next token is not a comma, we have reached the end of
          the list.  */
@@ -13817,8 +14011,10 @@ cp_parser_member_declaration (cp_parser* parser)
       if (!decl_specifiers.any_specifiers_p)
         {
           cp_token *token = cp_lexer_peek_token (parser->lexer);
-          if (pedantic && !token->in_system_header)
-            pedwarn ("%Hextra %<;%>", &token->location);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+          if (pedantic && !cp_token_in_system_header (token))
+            pedwarn ("%Hextra %<;%>", &cp_token_source_of (token)->location);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
         }
       else
         {
@@ -16052,9 +16248,11 @@ cp_parser_enclosed_template_argument_list (cp_parser* parser)
             global source location is still on the token before the
             '>>', so we need to say explicitly where we want it.  */
           cp_token *token = cp_lexer_peek_token (parser->lexer);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
           error ("%H%<>>%> should be %<> >%> "
                  "within a nested template argument list",
-                 &token->location);
+                 &cp_token_source_of (token)->location);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
           /* ??? Proper recovery should terminate two levels of
              template argument list here.  */
@@ -17933,7 +18131,9 @@ cp_parser_objc_try_catch_finally_statement (cp_parser *parser) {
   tree stmt;
 
   cp_parser_require_keyword (parser, RID_AT_TRY, "`@try'");
-  location = cp_lexer_peek_token (parser->lexer)->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  location = cp_token_location (cp_lexer_peek_token (parser->lexer));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   /* NB: The @try block needs to be wrapped in its own STATEMENT_LIST
      node, lest it get absorbed into the surrounding block.  */
   stmt = push_stmt_list ();
@@ -17961,7 +18161,9 @@ cp_parser_objc_try_catch_finally_statement (cp_parser *parser) {
   if (cp_lexer_next_token_is_keyword (parser->lexer, RID_AT_FINALLY))
     {
       cp_lexer_consume_token (parser->lexer);
-      location = cp_lexer_peek_token (parser->lexer)->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      location = cp_token_location (cp_lexer_peek_token (parser->lexer));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
       /* NB: The @finally block needs to be wrapped in its own STATEMENT_LIST
          node, lest it get absorbed into the surrounding block.  */
       stmt = push_stmt_list ();
@@ -17986,7 +18188,9 @@ cp_parser_objc_synchronized_statement (cp_parser *parser) {
 
   cp_parser_require_keyword (parser, RID_AT_SYNCHRONIZED, "`@synchronized'");
 
-  location = cp_lexer_peek_token (parser->lexer)->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  location = cp_token_location (cp_lexer_peek_token (parser->lexer));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   cp_parser_require (parser, CPP_OPEN_PAREN, "`('");
   lock = cp_parser_expression (parser, false);
   cp_parser_require (parser, CPP_CLOSE_PAREN, "`)'");
@@ -18810,7 +19014,9 @@ cp_parser_omp_for_loop (cp_parser *parser)
       cp_parser_error (parser, "for statement expected");
       return NULL;
     }
-  loc = cp_lexer_consume_token (parser->lexer)->location;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  loc = cp_token_location (cp_lexer_consume_token (parser->lexer));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (!cp_parser_require (parser, CPP_OPEN_PAREN, "`('"))
     return NULL;
 
@@ -19223,7 +19429,9 @@ cp_parser_omp_construct (cp_parser *parser, cp_token *pragma_tok)
     }
 
   if (stmt)
-    SET_EXPR_LOCATION (stmt, pragma_tok->location);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    SET_EXPR_LOCATION (stmt, cp_token_location (pragma_tok));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* The parser.  */
@@ -19391,6 +19599,24 @@ pragma_lex (tree *value)
 
 /* External interface.  */
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Print the memory taken by the tokens of the main lexer for
+   -fmem-report.  */
+
+void
+print_parser_statistics (void)
+{
+  fprintf (stderr, "%lu tokens lexed, %lu kB at %lu bytes each\n",
+           n_tokens_lexed,
+           (unsigned long) (n_tokens_lexed * sizeof (cp_token)) / 1024,
+           (unsigned long) sizeof (cp_token));
+  fprintf (stderr, "%lu token source positions, %lu kB at %lu bytes each\n",
+           n_token_sources,
+           (unsigned long) (n_token_sources * sizeof (cp_token_source)) / 1024,
+           (unsigned long) sizeof (cp_token_source));
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Parse one entire translation unit.  */
 
 void
@@ -51,14 +51,113 @@ Boston, MA 02110-1301, USA.  */
    returning an int.  */
 typedef int (*tree_fn_t) (tree, void*);
 
-/* The PENDING_TEMPLATES is a TREE_LIST of templates whose
-   instantiations have been deferred, either because their definitions
-   were not yet available, or because we were putting off doing the work.
-   The TREE_PURPOSE of each entry is either a DECL (for a function or
-   static data member), or a TYPE (for a class) indicating what we are
-   hoping to instantiate.  The TREE_VALUE is not used.  */
-static GTY(()) tree pending_templates;
-static GTY(()) tree last_pending_template;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* An entry in PENDING_TEMPLATES.  */
+typedef struct pending_template GTY (())
+{
+  /* A DECL (for a function or static data member), or a TYPE (for a
+     class) indicating what we are hoping to instantiate.  */
+  tree t;
+  /* The TINST_LEVEL in effect when the instantiation was requested.  */
+  tree tinst;
+} pending_template;
+
+DEF_VEC_O(pending_template);
+DEF_VEC_ALLOC_O(pending_template,gc);
+
+/* The PENDING_TEMPLATES are the templates whose instantiations have
+   been deferred, either because their definitions were not yet
+   available, or because we were putting off doing the work.  They are
+   kept in the order they were requested.  PENDING_TEMPLATE_HTAB holds
+   the same templates, so that a template whose TI_PENDING_TEMPLATE_FLAG
+   was cleared by a failed instantiation attempt is not queued twice.  */
+static GTY(()) VEC(pending_template,gc) *pending_templates;
+static GTY ((param_is (union tree_node))) htab_t pending_template_htab;
+
+/* One level of the template instantiation stack.  The frames are kept
+   in TINST_STACK, innermost last, and a TINST_LEVEL node is built for
+   a frame only when a diagnostic or a deferred instantiation needs the
+   instantiation context as a tree.  */
+typedef struct tinst_frame GTY (())
+{
+  tree decl;
+  location_t locus;
+  int in_system_header_p;
+  /* The TINST_LEVEL for this frame, or NULL_TREE if none has been built
+     yet.  If a frame has one, so do all the frames outside it.  */
+  tree level;
+} tinst_frame;
+
+DEF_VEC_O(tinst_frame);
+DEF_VEC_ALLOC_O(tinst_frame,gc);
+
+static GTY(()) VEC(tinst_frame,gc) *tinst_stack;
+
+/* Statistics reported by print_template_statistics.  */
+static int n_tinst_frames_pushed;
+static int n_tinst_levels_built;
+static int n_pending_templates_added;
+static int n_pending_templates_duplicate;
+static int n_lazy_members_deferred;
+static int n_lazy_members_instantiated;
+
+/* What -ftemplate-report records about one template.
+   instantiate_class_template and instantiate_decl charge their work to
+   the most general template of what they instantiate.  Times are in
+   microseconds and memory in bytes allocated from the collected heap.
+   The inclusive figures cover everything done while an instantiation
+   of the template was in progress, counted once when the template
+   instantiates itself recursively.  The exclusive figures leave out
+   the instantiations nested in it.  */
+typedef struct template_cost GTY (())
+{
+  tree tmpl;
+  /* The class instantiations, and the function and static data
+     member instantiations.  */
+  int n_classes;
+  int n_decls;
+  /* The number of instantiations of TMPL in progress.  */
+  int active;
+  HOST_WIDE_INT inclusive_time;
+  HOST_WIDE_INT exclusive_time;
+  HOST_WIDE_INT inclusive_mem;
+  HOST_WIDE_INT exclusive_mem;
+} template_cost;
+
+DEF_VEC_O(template_cost);
+DEF_VEC_ALLOC_O(template_cost,gc);
+
+static GTY(()) VEC(template_cost,gc) *template_costs;
+
+/* Maps a template to one more than the index of its entry in
+   TEMPLATE_COSTS.  */
+static struct pointer_map_t *template_cost_map;
+
+/* An instantiation in progress, for -ftemplate-report.  The frames are
+   pushed and popped together with the TINST_STACK frames of
+   instantiate_class_template and instantiate_decl.  */
+typedef struct template_cost_frame GTY (())
+{
+  /* The index of the template in TEMPLATE_COSTS.  */
+  unsigned int ix;
+  HOST_WIDE_INT start_time;
+  size_t start_mem;
+  /* The time and memory of the instantiations nested in this one.  */
+  HOST_WIDE_INT nested_time;
+  size_t nested_mem;
+} template_cost_frame;
+
+DEF_VEC_O(template_cost_frame);
+DEF_VEC_ALLOC_O(template_cost_frame,heap);
+
+static VEC(template_cost_frame,heap) *template_cost_stack;
+
+/* True if -ftemplate-report or -ftemplate-report-file is given.  */
+#define TEMPLATE_REPORT_P (flag_template_report || template_report_file)
+
+/* The number of templates -ftemplate-report prints.  */
+#define TEMPLATE_REPORT_ROWS 30
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 int processing_template_parmlist;
 static int template_header_count;
@@ -66,8 +165,6 @@ static int template_header_count;
 static GTY(()) tree saved_trees;
 static VEC(int,heap) *inline_parm_levels;
 
-static GTY(()) tree current_tinst_level;
-
 static GTY(()) tree saved_access_scope;
 
 /* Live only within one (recursive) call to tsubst_expr.  We use
@@ -100,6 +197,18 @@ static void add_pending_template (tree);
 static int push_tinst_level (tree);
 static void pop_tinst_level (void);
 static void reopen_tinst_level (tree);
+static tree current_tinst_level (void);
+static bool lazy_member_p (tree);
+static struct pointer_set_t *lazy_member_exclusions (tree, tree);
+static void finish_lazy_members (tree);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static HOST_WIDE_INT template_cost_clock (void);
+static void begin_template_cost (tree);
+static void end_template_cost (tree);
+static int template_cost_cmp (const void *, const void *);
+static void print_template_report_file (template_cost **, unsigned int);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+static tree order_lazy_members (tree, tree);
 static tree classtype_mangled_name (tree);
 static char* mangle_class_name_for_template (const char *, tree, tree);
 static tree tsubst_initializer_list (tree, tree);
@@ -4394,7 +4503,8 @@ add_pending_template (tree d)
   tree ti = (TYPE_P (d)
              ? CLASSTYPE_TEMPLATE_INFO (d)
              : DECL_TEMPLATE_INFO (d));
-  tree pt;
+  pending_template *pt;
+  void **slot;
   int level;
 
 /* BEGIN GCC-XML MODIFICATIONS 2008-01-05 */
@@ -4407,21 +4517,35 @@ add_pending_template (tree d)
   if (TI_PENDING_TEMPLATE_FLAG (ti))
     return;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (!pending_template_htab)
+    pending_template_htab = htab_create_ggc_pow2 (64, htab_hash_pointer,
+                                                  htab_eq_pointer, NULL);
+  slot = htab_find_slot (pending_template_htab, d, INSERT);
+  if (*slot)
+    {
+      /* D is still queued; an attempt to instantiate it has failed and
+         cleared its flag.  */
+      ++n_pending_templates_duplicate;
+      TI_PENDING_TEMPLATE_FLAG (ti) = 1;
+      return;
+    }
+  *slot = d;
+  ++n_pending_templates_added;
+
   /* We are called both from instantiate_decl, where we've already had a
      tinst_level pushed, and instantiate_template, where we haven't.
      Compensate.  */
-  level = !(current_tinst_level && TINST_DECL (current_tinst_level) == d);
+  level = !(!VEC_empty (tinst_frame, tinst_stack)
+            && VEC_last (tinst_frame, tinst_stack)->decl == d);
 
   if (level)
     push_tinst_level (d);
 
-  pt = tree_cons (current_tinst_level, d, NULL_TREE);
-  if (last_pending_template)
-    TREE_CHAIN (last_pending_template) = pt;
-  else
-    pending_templates = pt;
-
-  last_pending_template = pt;
+  pt = VEC_safe_push (pending_template, gc, pending_templates, NULL);
+  pt->t = d;
+  pt->tinst = current_tinst_level ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   TI_PENDING_TEMPLATE_FLAG (ti) = 1;
 
@@ -5230,7 +5354,7 @@ static int last_template_error_tick;
 static int
 push_tinst_level (tree d)
 {
-  tree new;
+  tinst_frame *new;
 
   if (tinst_depth >= max_tinst_depth)
     {
@@ -5250,12 +5374,16 @@ push_tinst_level (tree d)
       return 0;
     }
 
-  new = make_node (TINST_LEVEL);
-  TINST_DECL (new) = d;
-  TINST_LOCATION (new) = input_location;
-  TINST_IN_SYSTEM_HEADER_P (new) = in_system_header;
-  TREE_CHAIN (new) = current_tinst_level;
-  current_tinst_level = new;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (!tinst_stack)
+    tinst_stack = VEC_alloc (tinst_frame, gc, 64);
+  new = VEC_safe_push (tinst_frame, gc, tinst_stack, NULL);
+  new->decl = d;
+  new->locus = input_location;
+  new->in_system_header_p = in_system_header;
+  new->level = NULL_TREE;
+  ++n_tinst_frames_pushed;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   ++tinst_depth;
 #ifdef GATHER_STATISTICS
@@ -5273,13 +5401,13 @@ push_tinst_level (tree d)
 static void
 pop_tinst_level (void)
 {
-  tree old = current_tinst_level;
+  tinst_frame *old = VEC_last (tinst_frame, tinst_stack);
 
   /* Restore the filename and line number stashed away when we started
      this instantiation.  */
-  input_location = TINST_LOCATION (old);
-  in_system_header = TINST_IN_SYSTEM_HEADER_P (old);
-  current_tinst_level = TREE_CHAIN (old);
+  input_location = old->locus;
+  in_system_header = old->in_system_header_p;
+  VEC_pop (tinst_frame, tinst_stack);
   --tinst_depth;
   ++tinst_level_tick;
 }
@@ -5291,15 +5419,264 @@ pop_tinst_level (void)
 static void
 reopen_tinst_level (tree level)
 {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
   tree t;
+  unsigned ix;
 
   tinst_depth = 0;
   for (t = level; t; t = TREE_CHAIN (t))
     ++tinst_depth;
 
-  current_tinst_level = level;
+  /* Rebuild the frames from LEVEL, outermost first.  Each frame keeps
+     its TINST_LEVEL so that the context is not built again.  */
+  VEC_truncate (tinst_frame, tinst_stack, 0);
+  if (tinst_depth)
+    VEC_safe_grow (tinst_frame, gc, tinst_stack, tinst_depth);
+  for (t = level, ix = tinst_depth; t; t = TREE_CHAIN (t))
+    {
+      tinst_frame *frame = VEC_index (tinst_frame, tinst_stack, --ix);
+      frame->decl = TINST_DECL (t);
+      frame->locus = TINST_LOCATION (t);
+      frame->in_system_header_p = TINST_IN_SYSTEM_HEADER_P (t);
+      frame->level = t;
+    }
+
   pop_tinst_level ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+}
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the TINST_LEVEL for the current template instantiation
+   context, building the nodes for any frames that do not have one
+   yet.  */
+
+static tree
+current_tinst_level (void)
+{
+  unsigned len = VEC_length (tinst_frame, tinst_stack);
+  unsigned ix = len;
+  tree level = NULL_TREE;
+
+  /* Find the innermost frame whose TINST_LEVEL has been built.  */
+  while (ix > 0 && !VEC_index (tinst_frame, tinst_stack, ix - 1)->level)
+    --ix;
+  if (ix > 0)
+    level = VEC_index (tinst_frame, tinst_stack, ix - 1)->level;
+
+  for (; ix < len; ++ix)
+    {
+      tinst_frame *frame = VEC_index (tinst_frame, tinst_stack, ix);
+      tree t = make_node (TINST_LEVEL);
+
+      TINST_DECL (t) = frame->decl;
+      TINST_LOCATION (t) = frame->locus;
+      TINST_IN_SYSTEM_HEADER_P (t) = frame->in_system_header_p;
+      TREE_CHAIN (t) = level;
+      frame->level = level = t;
+      ++n_tinst_levels_built;
+    }
+
+  return level;
+}
+
+/* Print statistics about the template instantiation stack and the
+   pending templates for -fmem-report.  */
+
+void
+print_template_statistics (void)
+{
+  fprintf (stderr, "%d template instantiation levels pushed, "
+           "%d TINST_LEVEL nodes built\n",
+           n_tinst_frames_pushed, n_tinst_levels_built);
+  fprintf (stderr, "%d pending templates queued, %d duplicates skipped\n",
+           n_pending_templates_added, n_pending_templates_duplicate);
+  fprintf (stderr, "%d member functions deferred, %d instantiated lazily\n",
+           n_lazy_members_deferred, n_lazy_members_instantiated);
+}
+
+/* Return the current time in microseconds, for -ftemplate-report.  */
+
+static HOST_WIDE_INT
+template_cost_clock (void)
+{
+#ifdef HAVE_GETTIMEOFDAY
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (HOST_WIDE_INT) tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+  return get_run_time ();
+#endif
+}
+
+/* An instantiation of TMPL, a most general template, has begun.  */
+
+static void
+begin_template_cost (tree tmpl)
+{
+  template_cost_frame *frame;
+  unsigned int ix;
+  void **slot;
+
+  if (!template_cost_map)
+    template_cost_map = pointer_map_create ();
+  slot = pointer_map_insert (template_cost_map, tmpl);
+  if (*slot)
+    ix = (size_t) *slot - 1;
+  else
+    {
+      template_cost *cost;
+
+      ix = VEC_length (template_cost, template_costs);
+      cost = VEC_safe_push (template_cost, gc, template_costs, NULL);
+      memset (cost, 0, sizeof (*cost));
+      cost->tmpl = tmpl;
+      *slot = (void *) (size_t) (ix + 1);
+    }
+  VEC_index (template_cost, template_costs, ix)->active++;
+
+  frame = VEC_safe_push (template_cost_frame, heap, template_cost_stack,
+                         NULL);
+  frame->ix = ix;
+  frame->nested_time = 0;
+  frame->nested_mem = 0;
+  frame->start_mem = timevar_ggc_mem_total;
+  frame->start_time = template_cost_clock ();
+}
+
+/* The instantiation begun by the last call to begin_template_cost is
+   over.  D is the class, function or variable instantiated, or
+   NULL_TREE if nothing was instantiated after all.  */
+
+static void
+end_template_cost (tree d)
+{
+  HOST_WIDE_INT time = template_cost_clock ();
+  size_t mem = timevar_ggc_mem_total;
+  template_cost_frame *frame;
+  template_cost *cost;
+
+  frame = VEC_last (template_cost_frame, template_cost_stack);
+  cost = VEC_index (template_cost, template_costs, frame->ix);
+  time -= frame->start_time;
+  mem -= frame->start_mem;
+
+  if (d && TYPE_P (d))
+    cost->n_classes++;
+  else if (d)
+    cost->n_decls++;
+  cost->exclusive_time += time - frame->nested_time;
+  cost->exclusive_mem += mem - frame->nested_mem;
+  if (--cost->active == 0)
+    {
+      cost->inclusive_time += time;
+      cost->inclusive_mem += mem;
+    }
+
+  VEC_pop (template_cost_frame, template_cost_stack);
+  if (!VEC_empty (template_cost_frame, template_cost_stack))
+    {
+      frame = VEC_last (template_cost_frame, template_cost_stack);
+      frame->nested_time += time;
+      frame->nested_mem += mem;
+    }
+}
+
+/* Order the templates of the report by decreasing exclusive time,
+   then by decreasing inclusive time, then as they were first
+   instantiated.  */
+
+static int
+template_cost_cmp (const void *p1, const void *p2)
+{
+  const template_cost *c1 = *(const template_cost *const *) p1;
+  const template_cost *c2 = *(const template_cost *const *) p2;
+
+  if (c1->exclusive_time != c2->exclusive_time)
+    return c1->exclusive_time < c2->exclusive_time ? 1 : -1;
+  if (c1->inclusive_time != c2->inclusive_time)
+    return c1->inclusive_time < c2->inclusive_time ? 1 : -1;
+  return c1 < c2 ? -1 : c1 != c2;
+}
+
+/* Write the N templates of COSTS to the -ftemplate-report-file, one
+   line each with tab-separated fields named by a first line starting
+   with "#".  Times are in seconds and memory in kB.  */
+
+static void
+print_template_report_file (template_cost **costs, unsigned int n)
+{
+  FILE *fp;
+  unsigned int i;
+
+  fp = fopen (template_report_file, "w");
+  if (!fp)
+    {
+      error ("could not open template report file %s: %m",
+             template_report_file);
+      return;
+    }
+
+  fputs ("# template\tclasses\tdecls\tinclusive\texclusive"
+         "\tinclusive_kb\texclusive_kb\n", fp);
+  for (i = 0; i < n; i++)
+    fprintf (fp, "%s\t%d\t%d\t%.6f\t%.6f\t%lu\t%lu\n",
+             decl_as_string (costs[i]->tmpl, TFF_SCOPE),
+             costs[i]->n_classes, costs[i]->n_decls,
+             costs[i]->inclusive_time * 1e-6,
+             costs[i]->exclusive_time * 1e-6,
+             (unsigned long) (costs[i]->inclusive_mem >> 10),
+             (unsigned long) (costs[i]->exclusive_mem >> 10));
+
+  if (fclose (fp))
+    error ("writing template report file %s: %m", template_report_file);
+}
+
+/* Print what the instantiations of each template cost, most expensive
+   first, for -ftemplate-report, and write it to the
+   -ftemplate-report-file.  */
+
+void
+print_template_report (void)
+{
+  unsigned int n = VEC_length (template_cost, template_costs);
+  template_cost **costs;
+  unsigned int i;
+
+  if (!TEMPLATE_REPORT_P)
+    return;
+
+  costs = XNEWVEC (template_cost *, n);
+  for (i = 0; i < n; i++)
+    costs[i] = VEC_index (template_cost, template_costs, i);
+  qsort (costs, n, sizeof (template_cost *), template_cost_cmp);
+
+  if (flag_template_report)
+    {
+      fprintf (stderr, "\nTemplate instantiations (%u templates", n);
+      if (n > TEMPLATE_REPORT_ROWS)
+        fprintf (stderr, ", the %d with the most exclusive time",
+                 TEMPLATE_REPORT_ROWS);
+      fputs ("):\n", stderr);
+      fprintf (stderr, " %7s %7s %9s %9s %10s %10s  %s\n",
+               "classes", "decls", "incl (s)", "excl (s)",
+               "incl (kB)", "excl (kB)", "template");
+      for (i = 0; i < n && i < TEMPLATE_REPORT_ROWS; i++)
+        fprintf (stderr, " %7d %7d %9.3f %9.3f %10lu %10lu  %s\n",
+                 costs[i]->n_classes, costs[i]->n_decls,
+                 costs[i]->inclusive_time * 1e-6,
+                 costs[i]->exclusive_time * 1e-6,
+                 (unsigned long) (costs[i]->inclusive_mem >> 10),
+                 (unsigned long) (costs[i]->exclusive_mem >> 10),
+                 decl_as_string (costs[i]->tmpl, TFF_SCOPE));
+    }
+
+  if (template_report_file)
+    print_template_report_file (costs, n);
+
+  free (costs);
 }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* DECL is a friend FUNCTION_DECL or TEMPLATE_DECL.  ARGS is the
    vector of template arguments, as for tsubst.
@@ -5681,6 +6058,165 @@ can_complete_type_without_circularity (tree type)
     return 1;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return true if T, a member of a class template, is a member function
+   whose instantiation can wait until its name is looked up in the
+   class.  Virtual functions, special member functions and operators
+   are always instantiated with the class, since finish_struct looks
+   at them.  */
+
+static bool
+lazy_member_p (tree t)
+{
+  return (TREE_CODE (t) == FUNCTION_DECL
+          && !DECL_ARTIFICIAL (t)
+          && !DECL_VIRTUAL_P (t)
+          && !DECL_CONSTRUCTOR_P (t)
+          && !DECL_DESTRUCTOR_P (t)
+          && !DECL_CONV_FN_P (t)
+          && !DECL_OVERLOADED_OPERATOR_P (t));
+}
+
+/* TYPE, an instantiation of PATTERN, is about to have its members
+   instantiated.  If some of them can be left for
+   instantiate_lazy_members, return the set of names whose member
+   functions must still be instantiated now; otherwise, return NULL.
+   The caller must destroy the set.  */
+
+static struct pointer_set_t *
+lazy_member_exclusions (tree type, tree pattern)
+{
+  struct pointer_set_t *names;
+  tree binfo, base_binfo, member;
+  int i;
+
+  if (!flag_lazy_template_members
+      || TYPE_FOR_JAVA (type)
+      || ANON_AGGR_TYPE_P (pattern)
+      /* The members of a local class may refer to local
+         specializations of the enclosing function, which are gone by
+         the time the name is looked up.  */
+      || decl_function_context (TYPE_MAIN_DECL (type)))
+    return NULL;
+
+  /* A member function that is not declared virtual may still override
+     a virtual function of a base.  */
+  binfo = TYPE_BINFO (type);
+  for (i = 0; BINFO_BASE_ITERATE (binfo, i, base_binfo); i++)
+    if (TYPE_POLYMORPHIC_P (BINFO_TYPE (base_binfo)))
+      return NULL;
+
+  for (member = CLASSTYPE_DECL_LIST (pattern);
+       member; member = TREE_CHAIN (member))
+    if (TREE_PURPOSE (member)
+        && !TYPE_P (TREE_VALUE (member))
+        && lazy_member_p (TREE_VALUE (member)))
+      break;
+  if (!member)
+    return NULL;
+
+  /* An overload set is instantiated all at once, so a name is excluded
+     if any of its member functions must be instantiated now.  Names
+     brought in by using-declarations are excluded too; finish_struct
+     checks them against the member functions of the class.  */
+  names = pointer_set_create ();
+  for (member = CLASSTYPE_DECL_LIST (pattern);
+       member; member = TREE_CHAIN (member))
+    {
+      tree t = TREE_VALUE (member);
+
+      if (!TREE_PURPOSE (member) || TYPE_P (t))
+        continue;
+      if (((TREE_CODE (t) == FUNCTION_DECL || DECL_FUNCTION_TEMPLATE_P (t))
+           && !lazy_member_p (t))
+          || TREE_CODE (t) == USING_DECL)
+        pointer_set_insert (names, DECL_NAME (t));
+    }
+
+  return names;
+}
+
+/* Return METHODS, a chain of member functions of a class, reordered
+   so that the instantiations recorded in LAZY, a CLASSTYPE_LAZY_MEMBERS
+   list whose entries are in declaration order, come last and in that
+   order.  The other member functions keep their order in front of
+   them.  */
+
+static tree
+order_lazy_members (tree methods, tree lazy)
+{
+  struct pointer_set_t *entries = pointer_set_create ();
+  struct pointer_set_t *present = pointer_set_create ();
+  VEC(tree,heap) *others = NULL;
+  tree list = NULL_TREE;
+  tree *tail = &list;
+  tree entry, fn;
+  unsigned ix;
+
+  for (entry = TREE_VALUE (lazy); entry; entry = TREE_CHAIN (entry))
+    if (TREE_VALUE (entry))
+      pointer_set_insert (entries, TREE_VALUE (entry));
+  for (fn = methods; fn; fn = TREE_CHAIN (fn))
+    {
+      pointer_set_insert (present, fn);
+      if (!pointer_set_contains (entries, fn))
+        VEC_safe_push (tree, heap, others, fn);
+    }
+
+  /* add_method may have rejected some of the entries.  */
+  for (entry = TREE_VALUE (lazy); entry; entry = TREE_CHAIN (entry))
+    if (TREE_VALUE (entry)
+        && pointer_set_contains (present, TREE_VALUE (entry)))
+      {
+        *tail = TREE_VALUE (entry);
+        tail = &TREE_CHAIN (*tail);
+      }
+  *tail = NULL_TREE;
+  for (ix = VEC_length (tree, others); ix-- > 0; )
+    {
+      fn = VEC_index (tree, others, ix);
+      TREE_CHAIN (fn) = list;
+      list = fn;
+    }
+
+  VEC_free (tree, heap, others);
+  pointer_set_destroy (present);
+  pointer_set_destroy (entries);
+  return list;
+}
+
+/* Called by instantiate_class_template once the members of TYPE have
+   been processed, while TYPE_METHODS is still in reverse order.  Put
+   the CLASSTYPE_LAZY_MEMBERS entries of TYPE in declaration order.
+   If member functions were instantiated early, because their name was
+   looked up while TYPE was being defined, reorder TYPE_METHODS so
+   that they are in declaration order too.  */
+
+static void
+finish_lazy_members (tree type)
+{
+  tree lazy = CLASSTYPE_LAZY_MEMBERS (type);
+  tree entry;
+  bool deferred_p = false;
+
+  TREE_VALUE (lazy) = nreverse (TREE_VALUE (lazy));
+
+  if (TREE_LANG_FLAG_0 (lazy))
+    {
+      TYPE_METHODS (type)
+        = nreverse (order_lazy_members (nreverse (TYPE_METHODS (type)),
+                                        lazy));
+      TREE_LANG_FLAG_0 (lazy) = 0;
+    }
+
+  for (entry = TREE_VALUE (lazy); entry; entry = TREE_CHAIN (entry))
+    if (!TREE_VALUE (entry))
+      deferred_p = true;
+  if (!deferred_p)
+    CLASSTYPE_LAZY_MEMBERS (type) = NULL_TREE;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 tree
 instantiate_class_template (tree type)
 {
@@ -5688,6 +6224,9 @@ instantiate_class_template (tree type)
   tree typedecl;
   tree pbinfo;
   tree base_list;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  struct pointer_set_t *eager_names;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (type == error_mark_node)
     return error_mark_node;
@@ -5738,6 +6277,10 @@ instantiate_class_template (tree type)
   /* If we've recursively instantiated too many templates, stop.  */
   if (! push_tinst_level (type))
     return type;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (TEMPLATE_REPORT_P)
+    begin_template_cost (template);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Now we're really doing the instantiation.  Mark the type as in
      the process of being defined.  */
@@ -5837,6 +6380,21 @@ instantiate_class_template (tree type)
      class.  */
   pushclass (type);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  eager_names = lazy_member_exclusions (type, pattern);
+  if (eager_names)
+    {
+      /* Remember the point of instantiation for diagnostics.  */
+      tinst_frame *frame = VEC_last (tinst_frame, tinst_stack);
+      tree point = make_node (TINST_LEVEL);
+
+      TINST_DECL (point) = type;
+      TINST_LOCATION (point) = frame->locus;
+      TINST_IN_SYSTEM_HEADER_P (point) = frame->in_system_header_p;
+      CLASSTYPE_LAZY_MEMBERS (type) = tree_cons (args, NULL_TREE, point);
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Now members are processed in the order of declaration.  */
   for (member = CLASSTYPE_DECL_LIST (pattern);
        member; member = TREE_CHAIN (member))
@@ -5902,6 +6460,20 @@ instantiate_class_template (tree type)
               /* Build new TYPE_METHODS.  */
               tree r;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+              if (eager_names
+                  && lazy_member_p (t)
+                  && !pointer_set_contains (eager_names, DECL_NAME (t)))
+                {
+                  /* Leave it for instantiate_lazy_members.  */
+                  TREE_VALUE (CLASSTYPE_LAZY_MEMBERS (type))
+                    = tree_cons (t, NULL_TREE,
+                                 TREE_VALUE (CLASSTYPE_LAZY_MEMBERS (type)));
+                  ++n_lazy_members_deferred;
+                  continue;
+                }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
               if (TREE_CODE (t) == TEMPLATE_DECL)
                 ++processing_template_decl;
               r = tsubst (t, args, tf_error, NULL_TREE);
@@ -5909,6 +6481,12 @@ instantiate_class_template (tree type)
                 --processing_template_decl;
               set_current_access_from_decl (r);
               finish_member_declaration (r);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+              if (eager_names)
+                TREE_VALUE (CLASSTYPE_LAZY_MEMBERS (type))
+                  = tree_cons (t, r,
+                               TREE_VALUE (CLASSTYPE_LAZY_MEMBERS (type)));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
             }
           else
             {
@@ -6106,6 +6684,14 @@ instantiate_class_template (tree type)
      that would be used for non-template classes.  */
   input_location = DECL_SOURCE_LOCATION (typedecl);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (eager_names)
+    {
+      pointer_set_destroy (eager_names);
+      finish_lazy_members (type);
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   unreverse_member_declarations (type);
   finish_struct_1 (type);
   TYPE_BEING_DEFINED (type) = 0;
@@ -6125,6 +6711,10 @@ instantiate_class_template (tree type)
   popclass ();
   pop_from_top_level ();
   pop_deferring_access_checks ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (TEMPLATE_REPORT_P)
+    end_template_cost (type);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   pop_tinst_level ();
 
   /* The vtable for a template class can be emitted in any translation
@@ -6137,6 +6727,124 @@ instantiate_class_template (tree type)
   return type;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Instantiate the member functions of TYPE that instantiate_class_template
+   left for later; see CLASSTYPE_LAZY_MEMBERS.  If NAME is non-NULL,
+   only those called NAME are instantiated.  This is called when a name
+   is looked up in TYPE, and for all of them when every member of TYPE
+   is needed.  An ill-formed declaration is diagnosed only when it is
+   instantiated, but in the context of the point of instantiation of
+   TYPE, as it would have been by instantiate_class_template.  */
+
+void
+instantiate_lazy_members (tree type, tree name)
+{
+  tree lazy, entry, args, template, typedecl, point;
+  location_t saved_location;
+  int saved_in_system_header;
+  bool complete_p;
+
+  type = TYPE_MAIN_VARIANT (type);
+  lazy = CLASSTYPE_LAZY_MEMBERS (type);
+  for (entry = TREE_VALUE (lazy); entry; entry = TREE_CHAIN (entry))
+    if (!TREE_VALUE (entry)
+        && (!name || DECL_NAME (TREE_PURPOSE (entry)) == name))
+      break;
+  if (!entry)
+    return;
+
+  /* Diagnose problems as if they had been found when the class was
+     instantiated.  */
+  saved_location = input_location;
+  saved_in_system_header = in_system_header;
+  point = TREE_CHAIN (lazy);
+  input_location = TINST_LOCATION (point);
+  in_system_header = TINST_IN_SYSTEM_HEADER_P (point);
+  if (! push_tinst_level (type))
+    {
+      input_location = saved_location;
+      in_system_header = saved_in_system_header;
+      return;
+    }
+
+  /* This is the same environment instantiate_class_template sets up
+     for the members.  */
+  args = TREE_PURPOSE (lazy);
+  template = most_general_template (CLASSTYPE_TI_TEMPLATE (type));
+  complete_p = COMPLETE_TYPE_P (type);
+  /* The work is part of instantiating the class, but it is not another
+     instantiation.  */
+  if (TEMPLATE_REPORT_P)
+    begin_template_cost (template);
+  push_deferring_access_checks (dk_no_deferred);
+  push_to_top_level ();
+  typedecl = TYPE_MAIN_DECL (type);
+  input_location = DECL_SOURCE_LOCATION (typedecl);
+  in_system_header = DECL_IN_SYSTEM_HEADER (typedecl);
+  pushclass (type);
+
+  for (; entry; entry = TREE_CHAIN (entry))
+    {
+      tree t = TREE_PURPOSE (entry);
+      tree r;
+
+      if (TREE_VALUE (entry) || (name && DECL_NAME (t) != name))
+        continue;
+
+      /* Keep a lookup of NAME during the substitution from coming back
+         here for the same member.  */
+      TREE_VALUE (entry) = error_mark_node;
+      r = tsubst (t, args, tf_error, NULL_TREE);
+      set_current_access_from_decl (r);
+      finish_member_declaration (r);
+      TREE_VALUE (entry) = r;
+      ++n_lazy_members_instantiated;
+
+      if (r == error_mark_node)
+        continue;
+      /* finish_member_declaration put R at the head of TYPE_METHODS;
+         it is moved to its place below, or by finish_lazy_members if
+         TYPE is still being defined.  */
+      TREE_LANG_FLAG_0 (lazy) = 1;
+      if (complete_p)
+        {
+          DECL_IN_AGGR_P (r) = 0;
+          if (!PRIMARY_TEMPLATE_P (template))
+            tsubst_default_arguments (r);
+        }
+    }
+
+  if (complete_p)
+    {
+      if (TREE_LANG_FLAG_0 (lazy))
+        {
+          tree variant;
+
+          TYPE_METHODS (type) = order_lazy_members (TYPE_METHODS (type),
+                                                    lazy);
+          for (variant = TYPE_NEXT_VARIANT (type);
+               variant; variant = TYPE_NEXT_VARIANT (variant))
+            TYPE_METHODS (variant) = TYPE_METHODS (type);
+          TREE_LANG_FLAG_0 (lazy) = 0;
+        }
+      for (entry = TREE_VALUE (lazy); entry; entry = TREE_CHAIN (entry))
+        if (!TREE_VALUE (entry))
+          break;
+      if (!entry && CLASSTYPE_LAZY_MEMBERS (type) == lazy)
+        CLASSTYPE_LAZY_MEMBERS (type) = NULL_TREE;
+    }
+
+  popclass ();
+  pop_from_top_level ();
+  pop_deferring_access_checks ();
+  if (TEMPLATE_REPORT_P)
+    end_template_cost (NULL_TREE);
+  pop_tinst_level ();
+  input_location = saved_location;
+  in_system_header = saved_in_system_header;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 static tree
 tsubst_template_arg (tree t, tree args, tsubst_flags_t complain, tree in_decl)
 {
@@ -11855,6 +12563,11 @@ do_type_instantiation (tree t, tree storage, tsubst_flags_t complain)
        *explicit* instantiations or not.  However, the most natural
        interpretation is that it should be an explicit instantiation.  */
 
+    /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+    if (CLASSTYPE_LAZY_MEMBERS (t))
+      instantiate_lazy_members (t, NULL_TREE);
+    /* END GCC-XML MODIFICATIONS 2026-10-18 */
+
     if (! static_p)
       for (tmp = TYPE_METHODS (t); tmp; tmp = TREE_CHAIN (tmp))
         if (TREE_CODE (tmp) == FUNCTION_DECL
@@ -12094,6 +12807,10 @@ instantiate_decl (tree d, int defer_ok,
   /* This needs to happen before any tsubsting.  */
   if (! push_tinst_level (d))
     return d;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (TEMPLATE_REPORT_P)
+    begin_template_cost (gen_tmpl);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   timevar_push (TV_PARSE);
 
@@ -12319,10 +13036,12 @@ instantiate_decl (tree d, int defer_ok,
       saved_local_specializations = local_specializations;
 
       /* Set up the list of local specializations.  */
-      local_specializations = htab_create (37,
-                                           hash_local_specialization,
-                                           eq_local_specializations,
-                                           NULL);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      local_specializations = htab_create_pow2 (37,
+                                                hash_local_specialization,
+                                                eq_local_specializations,
+                                                NULL);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       /* Set up context.  */
       start_preparsed_function (d, NULL_TREE, SF_PRE_PARSED);
@@ -12369,6 +13088,10 @@ out:
   input_location = saved_loc;
   in_system_header = saved_in_system_header;
   pop_deferring_access_checks ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (TEMPLATE_REPORT_P)
+    end_template_cost (DECL_TEMPLATE_INSTANTIATED (d) ? d : NULL_TREE);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   pop_tinst_level ();
 
   timevar_pop (TV_PARSE);
@@ -12383,8 +13106,7 @@ out:
 void
 instantiate_pending_templates (int retries)
 {
-  tree *t;
-  tree last = NULL_TREE;
+  unsigned ix, kept;
   int reconsider;
   location_t saved_loc = input_location;
   int saved_in_system_header = in_system_header;
@@ -12392,9 +13114,10 @@ instantiate_pending_templates (int retries)
   /* Instantiating templates may trigger vtable generation.  This in turn
      may require further template instantiations.  We place a limit here
      to avoid infinite loop.  */
-  if (pending_templates && retries >= max_tinst_depth)
+  if (!VEC_empty (pending_template, pending_templates)
+      && retries >= max_tinst_depth)
     {
-      tree decl = TREE_VALUE (pending_templates);
+      tree decl = VEC_index (pending_template, pending_templates, 0)->t;
 
       error ("template instantiation depth exceeds maximum of %d"
              " instantiating %q+D, possibly from virtual table generation"
@@ -12410,12 +13133,20 @@ instantiate_pending_templates (int retries)
     {
       reconsider = 0;
 
-      t = &pending_templates;
-      while (*t)
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* Instantiations are appended to PENDING_TEMPLATES while we walk
+         it, so the length is checked on every iteration.  The entries
+         we keep are compacted towards the front.  */
+      for (ix = kept = 0;
+           ix < VEC_length (pending_template, pending_templates);
+           ++ix)
         {
-          tree instantiation = TREE_VALUE (*t);
+          pending_template pt
+            = *VEC_index (pending_template, pending_templates, ix);
+          tree instantiation = pt.t;
+          int done;
 
-          reopen_tinst_level (TREE_PURPOSE (*t));
+          reopen_tinst_level (pt.tinst);
 
           if (TYPE_P (instantiation))
             {
@@ -12424,6 +13155,11 @@ instantiate_pending_templates (int retries)
               if (!COMPLETE_TYPE_P (instantiation))
                 {
                   instantiate_class_template (instantiation);
+                  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+                  if (COMPLETE_TYPE_P (instantiation)
+                      && CLASSTYPE_LAZY_MEMBERS (instantiation))
+                    instantiate_lazy_members (instantiation, NULL_TREE);
+                  /* END GCC-XML MODIFICATIONS 2026-10-18 */
                   if (CLASSTYPE_TEMPLATE_INSTANTIATION (instantiation))
                     for (fn = TYPE_METHODS (instantiation);
                          fn;
@@ -12436,15 +13172,9 @@ instantiate_pending_templates (int retries)
                     reconsider = 1;
                 }
 
-              if (COMPLETE_TYPE_P (instantiation))
-                /* If INSTANTIATION has been instantiated, then we don't
-                   need to consider it again in the future.  */
-                *t = TREE_CHAIN (*t);
-              else
-                {
-                  last = *t;
-                  t = &TREE_CHAIN (*t);
-                }
+              /* If INSTANTIATION has been instantiated, then we don't
+                 need to consider it again in the future.  */
+              done = COMPLETE_TYPE_P (instantiation);
             }
           else
             {
@@ -12459,21 +13189,22 @@ instantiate_pending_templates (int retries)
                     reconsider = 1;
                 }
 
-              if (DECL_TEMPLATE_SPECIALIZATION (instantiation)
-                  || DECL_TEMPLATE_INSTANTIATED (instantiation))
-                /* If INSTANTIATION has been instantiated, then we don't
-                   need to consider it again in the future.  */
-                *t = TREE_CHAIN (*t);
-              else
-                {
-                  last = *t;
-                  t = &TREE_CHAIN (*t);
-                }
+              /* If INSTANTIATION has been instantiated, then we don't
+                 need to consider it again in the future.  */
+              done = (DECL_TEMPLATE_SPECIALIZATION (instantiation)
+                      || DECL_TEMPLATE_INSTANTIATED (instantiation));
             }
+
+          if (done)
+            htab_remove_elt (pending_template_htab, pt.t);
+          else
+            *VEC_index (pending_template, pending_templates, kept++) = pt;
+
           tinst_depth = 0;
-          current_tinst_level = NULL_TREE;
+          VEC_truncate (tinst_frame, tinst_stack, 0);
         }
-      last_pending_template = last;
+      VEC_truncate (pending_template, pending_templates, kept);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
     }
   while (reconsider);
 
@@ -12648,7 +13379,9 @@ record_last_problematic_instantiation (void)
 tree
 current_instantiation (void)
 {
-  return current_tinst_level;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  return current_tinst_level ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* [temp.param] Check that template non-type parm TYPE is of an allowable
@@ -34,6 +34,9 @@ Boston, MA 02110-1301, USA.  */
 #include "rtl.h"
 #include "output.h"
 #include "toplev.h"
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#include "pointer-set.h"
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 static int is_subobject_of_p (tree, tree);
 static tree dfs_lookup_base (tree, void *);
@@ -64,6 +67,11 @@ static int protected_accessible_p (tree, tree, tree);
 static int friend_accessible_p (tree, tree, tree);
 static int template_self_reference_p (tree, tree);
 static tree dfs_get_pure_virtuals (tree, void *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static hashval_t lookup_base_entry_hash (const void *);
+static int lookup_base_entry_eq (const void *, const void *);
+static void add_member_name (struct pointer_set_t *, tree);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 
 /* Variables for gathering statistics.  */
@@ -148,6 +156,25 @@ dfs_lookup_base (tree binfo, void *data_)
   return NULL_TREE;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Hash and equality functions for the CLASSTYPE_BASE_CACHE.  */
+
+static hashval_t
+lookup_base_entry_hash (const void *p)
+{
+  const struct lookup_base_entry *e = (const struct lookup_base_entry *) p;
+  return htab_hash_pointer (e->base) ^ e->want_any;
+}
+
+static int
+lookup_base_entry_eq (const void *p1, const void *p2)
+{
+  const struct lookup_base_entry *e1 = (const struct lookup_base_entry *) p1;
+  const struct lookup_base_entry *e2 = (const struct lookup_base_entry *) p2;
+  return e1->base == e2->base && e1->want_any == e2->want_any;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Returns true if type BASE is accessible in T.  (BASE is known to be
    a (possibly non-proper) base class of T.)  If CONSIDER_LOCAL_P is
    true, consider any special access of the current scope, or access
@@ -218,6 +245,33 @@ lookup_base (tree t, tree base, base_access access, base_kind *kind_ptr)
   if (t_binfo)
     {
       struct lookup_base_data_s data;
+      /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* The hierarchy of a complete class does not change, so the
+         result of searching it from its own binfo is remembered.  */
+      struct lookup_base_entry key;
+      struct lookup_base_entry **slot = NULL;
+
+      key.base = base;
+      key.want_any = access == ba_any;
+      if (t_binfo == TYPE_BINFO (t)
+          && CLASS_TYPE_P (t)
+          && COMPLETE_TYPE_P (t)
+          && !TYPE_BEING_DEFINED (t))
+        {
+          if (!CLASSTYPE_BASE_CACHE (t))
+            CLASSTYPE_BASE_CACHE (t)
+              = htab_create_ggc (7, lookup_base_entry_hash,
+                                 lookup_base_entry_eq, NULL);
+          slot = (struct lookup_base_entry **)
+            htab_find_slot (CLASSTYPE_BASE_CACHE (t), &key, INSERT);
+          if (*slot)
+            {
+              binfo = (*slot)->binfo;
+              bk = (base_kind) (*slot)->kind;
+              goto found;
+            }
+        }
+      /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       data.t = t;
       data.base = base;
@@ -237,6 +291,16 @@ lookup_base (tree t, tree base, base_access access, base_kind *kind_ptr)
         bk = bk_via_virtual;
       else
         bk = bk_proper_base;
+
+      /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      if (slot)
+        {
+          *slot = GGC_NEW (struct lookup_base_entry);
+          **slot = key;
+          (*slot)->binfo = binfo;
+          (*slot)->kind = bk;
+        }
+      /* END GCC-XML MODIFICATIONS 2026-10-18 */
     }
   else
     {
@@ -244,6 +308,10 @@ lookup_base (tree t, tree base, base_access access, base_kind *kind_ptr)
       bk = bk_not_base;
     }
 
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+ found:
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Check that the base is unambiguous and accessible.  */
   if (access != ba_any)
     switch (bk)
@@ -374,6 +442,56 @@ dcast_base_hint (tree subtype, tree target)
    Otherwise, return a DECL with the indicated name.  If WANT_TYPE is
    true, type declarations are preferred.  */
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The number of fields lookup_field_1 walks in a class being defined
+   before it starts keeping the CLASSTYPE_MEMBER_NAMES of the class.
+   Generated headers declare enumerations with many thousands of
+   enumerators at class scope, and every one of them looks up its
+   name in the class before it is added.  */
+#define MEMBER_NAMES_THRESHOLD 64
+
+/* Add the name of FIELD, or the names of the members of FIELD if it
+   is an anonymous aggregate, to NAMES.  */
+
+static void
+add_member_name (struct pointer_set_t *names, tree field)
+{
+  if (DECL_NAME (field))
+    pointer_set_insert (names, DECL_NAME (field));
+  else if (ANON_AGGR_TYPE_P (TREE_TYPE (field)))
+    {
+      tree f;
+
+      for (f = TYPE_FIELDS (TREE_TYPE (field)); f; f = TREE_CHAIN (f))
+        add_member_name (names, f);
+    }
+}
+
+/* DECL has been added to the TYPE_FIELDS of TYPE, which is being
+   defined.  Keep the CLASSTYPE_MEMBER_NAMES of TYPE up to date.  */
+
+void
+note_member_name (tree type, tree decl)
+{
+  if (CLASSTYPE_MEMBER_NAMES (type))
+    add_member_name (CLASSTYPE_MEMBER_NAMES (type), decl);
+}
+
+/* The TYPE_FIELDS of TYPE are about to be laid out and no longer
+   change only through finish_member_declaration.  Drop its
+   CLASSTYPE_MEMBER_NAMES.  */
+
+void
+forget_member_names (tree type)
+{
+  if (CLASSTYPE_MEMBER_NAMES (type))
+    {
+      pointer_set_destroy (CLASSTYPE_MEMBER_NAMES (type));
+      SET_CLASSTYPE_MEMBER_NAMES (type, NULL);
+    }
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Do a 1-level search for NAME as a member of TYPE.  The caller must
    figure out whether it can access this field.  (Since it is only one
    level, this is reasonable.)  */
@@ -382,6 +500,9 @@ tree
 lookup_field_1 (tree type, tree name, bool want_type)
 {
   tree field;
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  int n_fields = 0;
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (TREE_CODE (type) == TEMPLATE_TYPE_PARM
       || TREE_CODE (type) == BOUND_TEMPLATE_TEMPLATE_PARM
@@ -445,11 +566,21 @@ lookup_field_1 (tree type, tree name, bool want_type)
 
   field = TYPE_FIELDS (type);
 
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (CLASS_TYPE_P (type)
+      && CLASSTYPE_MEMBER_NAMES (type)
+      && !pointer_set_contains (CLASSTYPE_MEMBER_NAMES (type), name))
+    field = NULL_TREE;
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 #ifdef GATHER_STATISTICS
   n_calls_lookup_field_1++;
 #endif /* GATHER_STATISTICS */
-  for (field = TYPE_FIELDS (type); field; field = TREE_CHAIN (field))
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  for (; field; field = TREE_CHAIN (field))
     {
+      ++n_fields;
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 #ifdef GATHER_STATISTICS
       n_fields_searched++;
 #endif /* GATHER_STATISTICS */
@@ -483,6 +614,19 @@ lookup_field_1 (tree type, tree name, bool want_type)
         return field;
     }
   /* Not found.  */
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (n_fields > MEMBER_NAMES_THRESHOLD
+      && CLASS_TYPE_P (type)
+      && TYPE_BEING_DEFINED (type)
+      && !CLASSTYPE_MEMBER_NAMES (type))
+    {
+      struct pointer_set_t *names = pointer_set_create ();
+
+      for (field = TYPE_FIELDS (type); field; field = TREE_CHAIN (field))
+        add_member_name (names, field);
+      SET_CLASSTYPE_MEMBER_NAMES (type, names);
+    }
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (name == vptr_identifier)
     {
       /* Give the user what s/he thinks s/he wants.  */
@@ -1375,6 +1519,11 @@ lookup_fnfields_1 (tree type, tree name)
   if (!CLASS_TYPE_P (type))
     return -1;
 
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (CLASSTYPE_LAZY_MEMBERS (type))
+    instantiate_lazy_members (type, name);
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   if (COMPLETE_TYPE_P (type))
     {
       if ((name == ctor_identifier
@@ -2081,9 +2081,23 @@ finish_translation_unit (void)
   finish_fname_decls ();
 
 /* BEGIN GCC-XML MODIFICATIONS ($Date: 2007-10-31 15:08:43 $) */
-  /* Do XML output if enabled.  */
-  if (flag_xml)
-    do_xml_output (flag_xml);
+  /* Do XML output if enabled.  A plugin may consume the dump without
+     an output file.  */
+  if (flag_xml || flag_xml_plugin)
+    {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* Nothing is parsed after this point.  Give the memory of the
+         parse back before the dump grows the heap: a full collection
+         unmaps the pages of the token buffer, the macro definitions
+         and everything else only the parse used.  */
+      ggc_force_collect = true;
+      ggc_collect ();
+      ggc_force_collect = false;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+      timevar_push (TV_XML_OUTPUT);
+      do_xml_output (flag_xml);
+      timevar_pop (TV_XML_OUTPUT);
+    }
 /* END GCC-XML MODIFICATIONS ($Date: 2007-10-31 15:08:43 $) */
 }
 
@@ -2298,6 +2312,9 @@ finish_member_declaration (tree decl)
           TREE_CHAIN (decl) = TYPE_FIELDS (current_class_type);
           TYPE_FIELDS (current_class_type) = decl;
         }
+      /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      note_member_name (current_class_type, decl);
+      /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       maybe_add_class_template_decl_list (current_class_type, decl,
                                           /*friend_p=*/0);
@@ -1148,6 +1148,11 @@ cxx_print_statistics (void)
 {
   print_search_statistics ();
   print_class_statistics ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  print_decl_statistics ();
+  print_template_statistics ();
+  print_parser_statistics ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 #ifdef GATHER_STATISTICS
   fprintf (stderr, "maximum template instantiation depth reached: %d\n",
            depth_reached);
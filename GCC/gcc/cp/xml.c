@@ -28,6 +28,10 @@ along with this program; if not, write to the
 
    xml_print_*_attribute functions are used to write out the XML attributes
    for common attribute name/pair values.
+
+   Both write through the output primitives (xml_start_element,
+   xml_print_attribute, and friends), which also hand each element to
+   a consumer plugin loaded with -fxml-plugin= (see gccxml_plugin.h).
 */
 
 /* Use GCC_XML_GCC_VERSION to modify code based on the version of GCC
@@ -58,6 +62,7 @@ along with this program; if not, write to the
 #include "varray.h"
 
 #include "splay-tree.h"
+#include "hashtab.h"
 
 #include "demangle.h"
 
@@ -65,6 +70,11 @@ along with this program; if not, write to the
 
 #include "toplev.h" /* ident_hash */
 
+#include "obstack.h"
+
+#include "gccxml_plugin.h"
+#include "xml_plugin.h"
+
 #define GCC_XML_C_VERSION "$Revision: 1.134 $"
 
 /*--------------------------------------------------------------------------*/
@@ -73,6 +83,9 @@ along with this program; if not, write to the
 /* A "dump node" corresponding to a particular tree node.  */
 typedef struct xml_dump_node
 {
+  /* The tree node, or 0 if it has not been encountered.  */
+  tree tree_node;
+
   /* The index for the node.  */
   unsigned int index;
 
@@ -80,6 +93,10 @@ typedef struct xml_dump_node
   unsigned int complete;
 } *xml_dump_node_p;
 
+/* Dump nodes are stored by TREE_SERIAL of their tree node in blocks
+   of this many, so that they do not move as the table grows.  */
+#define XML_DUMP_NODE_BLOCK 1024
+
 /* A node on the queue of dump nodes.  */
 typedef struct xml_dump_queue
 {
@@ -103,13 +120,74 @@ typedef struct xml_file_queue
   struct xml_file_queue *next;
 } *xml_file_queue_p;
 
+/* The virtual functions of a class, and the functions of its bases,
+   that a virtual function overrides.  See xml_print_overrides.  */
+typedef struct xml_overrides_entry
+{
+  /* The class searched.  */
+  tree type;
+
+  /* The virtual function, as its representative in
+     xml_dump_info::signatures.  */
+  tree fndecl;
+
+  /* What xml_print_overrides_r finds for FNDECL in TYPE, in the order
+     it finds them.  */
+  VEC(tree,heap) *overridden;
+} *xml_overrides_entry_p;
+
+/* Deepest element nesting in a dump: the GCC_XML element, a
+   declaration or type, and its arguments, bases or values.  */
+#define XML_MAX_DEPTH 3
+
+/* An open element as seen by a consumer plugin.  */
+typedef struct xml_plugin_element
+{
+  /* The view passed to the plugin.  */
+  gccxml_element element;
+
+  /* Attribute storage, reused by later elements at the same depth.  */
+  gccxml_attribute* attributes;
+  unsigned int max_attributes;
+
+  /* Scratch storage in use before this element started.  */
+  char* scratch_base;
+} *xml_plugin_element_p;
+
+/* A loaded consumer plugin (see gccxml_plugin.h).  */
+typedef struct xml_plugin_info
+{
+  /* The callbacks filled in by the plugin.  */
+  gccxml_plugin callbacks;
+
+  /* The library handle.  */
+  void* handle;
+
+  /* Formatted and unescaped attribute values of the open elements.  */
+  struct obstack scratch;
+
+  /* The open elements, indexed by depth.  */
+  struct xml_plugin_element elements[XML_MAX_DEPTH];
+} *xml_plugin_info_p;
+
 /* Dump control structure.  A pointer one instance of this is passed
    to nearly every function.  */
 typedef struct xml_dump_info
 {
-  /* Output file stream of dump.  */
+  /* Output file stream of dump, or 0 when only a plugin is consuming
+     the dump.  */
   FILE* file;
 
+  /* Plugin receiving each element, or 0.  */
+  xml_plugin_info_p plugin;
+
+  /* Depth of the innermost open element.  The GCC_XML element is at
+     depth 0.  */
+  int depth;
+
+  /* Names of the open elements, indexed by depth.  */
+  const char* open_elements[XML_MAX_DEPTH];
+
   /* Which pass of the loop we are doing (1=complete or 0=incomplete).  */
   int require_complete;
 
@@ -125,8 +203,10 @@ typedef struct xml_dump_info
   /* List of free xml_dump_queue nodes.  */
   xml_dump_queue_p queue_free;
 
-  /* All nodes that have been encountered.  */
-  splay_tree dump_nodes;
+  /* All nodes that have been encountered, in blocks indexed by
+     TREE_SERIAL / XML_DUMP_NODE_BLOCK.  Unused blocks are 0.  */
+  xml_dump_node_p* dump_node_blocks;
+  unsigned int num_dump_node_blocks;
 
   /* Index of the next available file queue position.  */
   unsigned int file_index;
@@ -139,6 +219,25 @@ typedef struct xml_dump_info
 
   /* All files that have been queued.  */
   splay_tree file_nodes;
+
+  /* One virtual function for each signature that look_for_overrides_here
+     tells apart.  */
+  htab_t signatures;
+
+  /* The xml_overrides_entry of each class and signature searched.  */
+  htab_t overrides;
+
+  /* Result of xml_find_template_parm for each type and argument
+     vector searched, indexed by TREE_SERIAL: 0 if not searched yet,
+     1 if no template parameter was found, 2 if one was.  */
+  unsigned char* template_parm_found;
+  unsigned int template_parm_found_size;
+
+  /* The TEMPLATE_DECLs whose instantiations have been added as complete
+     nodes, in the order they were first added, and the same set for
+     lookup.  */
+  VEC(tree,heap) *templates;
+  htab_t template_set;
 } *xml_dump_info_p;
 
 /*--------------------------------------------------------------------------*/
@@ -287,11 +386,21 @@ void do_xml_document PARAMS ((const char*, const char*));
 
 static int xml_add_node PARAMS((xml_dump_info_p, tree, int));
 static void xml_dump PARAMS((xml_dump_info_p));
-static int xml_queue_incomplete_dump_nodes PARAMS((splay_tree_node, void*));
+static void xml_queue_incomplete_dump_nodes PARAMS((xml_dump_info_p));
+static int xml_add_late_instantiations PARAMS((xml_dump_info_p));
+static void xml_add_template_instantiations PARAMS((xml_dump_info_p, tree,
+                                                    int));
 static void xml_dump_tree_node PARAMS((xml_dump_info_p, tree, xml_dump_node_p));
 static void xml_dump_files PARAMS((xml_dump_info_p));
 
 static void xml_add_start_nodes PARAMS((xml_dump_info_p, const char*));
+static int xml_find_template_parm PARAMS((xml_dump_info_p, tree));
+
+static hashval_t xml_signature_hash PARAMS((const void*));
+static int xml_signature_eq PARAMS((const void*, const void*));
+static hashval_t xml_overrides_hash PARAMS((const void*));
+static int xml_overrides_eq PARAMS((const void*, const void*));
+static void xml_overrides_free PARAMS((void*));
 
 static const char* xml_get_encoded_string PARAMS ((tree));
 static const char* xml_get_encoded_string_from_string PARAMS ((const char*));
@@ -312,6 +421,406 @@ extern int errorcount;
     xml_add_node(xdi, node, complete))
 #endif
 
+/*--------------------------------------------------------------------------*/
+/* Output primitives.  Every element and attribute of the dump goes
+   through these.  They write the XML text when there is an output
+   file, and build the element views passed to a consumer plugin when
+   there is one.  Attribute values given to them are XML-encoded and
+   must stay valid until their element ends.  */
+
+/* Indentation of the element start tags, two spaces per level.  */
+static const char xml_indentation[2*XML_MAX_DEPTH+1] = "      ";
+
+/* Decode the XML entities in the LEN characters at S in place.
+   Return the decoded length.  */
+static size_t
+xml_decode_in_place (char* s, size_t len)
+{
+  static const struct { const char* text; size_t length; char c; }
+  entities[] = {{"&amp;", 5, '&'}, {"&lt;", 4, '<'}, {"&gt;", 4, '>'},
+                {"&apos;", 6, '\''}, {"&quot;", 6, '"'}};
+  const char* in = s;
+  const char* end = s + len;
+  char* out = s;
+  while (in < end)
+    {
+    if (*in == '&')
+      {
+      size_t i;
+      for (i=0; i < ARRAY_SIZE (entities); ++i)
+        {
+        if ((size_t)(end - in) >= entities[i].length &&
+            strncmp (in, entities[i].text, entities[i].length) == 0)
+          {
+          break;
+          }
+        }
+      if (i < ARRAY_SIZE (entities))
+        {
+        *out++ = entities[i].c;
+        in += entities[i].length;
+        continue;
+        }
+      }
+    *out++ = *in++;
+    }
+  *out = '\0';
+  return out - s;
+}
+
+/* Begin the plugin's view of element KIND at DEPTH.  */
+static void
+xml_plugin_start_element (xml_plugin_info_p pi, int depth, const char* kind)
+{
+  xml_plugin_element_p pe = &pi->elements[depth];
+  pe->scratch_base = (char*) obstack_alloc (&pi->scratch, 0);
+  pe->element.kind.data = kind;
+  pe->element.kind.length = strlen (kind);
+  pe->element.id.data = "";
+  pe->element.id.length = 0;
+  pe->element.name = pe->element.id;
+  pe->element.parent = depth? &pi->elements[depth-1].element : 0;
+  pe->element.depth = depth;
+  pe->element.attributes = 0;
+  pe->element.num_attributes = 0;
+}
+
+/* Add attribute NAME to the plugin's view of the element at DEPTH.
+   The caller sets its value with xml_plugin_set_value.  */
+static gccxml_attribute*
+xml_plugin_add_attribute (xml_plugin_info_p pi, int depth,
+                          const char* name, gccxml_value_kind kind)
+{
+  xml_plugin_element_p pe = &pi->elements[depth];
+  gccxml_attribute* a;
+  if (pe->element.num_attributes == pe->max_attributes)
+    {
+    pe->max_attributes = pe->max_attributes? 2*pe->max_attributes : 16;
+    pe->attributes = XRESIZEVEC (gccxml_attribute, pe->attributes,
+                                 pe->max_attributes);
+    }
+  a = &pe->attributes[pe->element.num_attributes++];
+  a->name.data = name;
+  a->name.length = strlen (name);
+  a->kind = kind;
+  return a;
+}
+
+/* Set attribute A of the element at DEPTH to the XML-encoded string
+   VALUE of length LEN.  A decoded copy is made only when VALUE
+   contains an entity.  */
+static void
+xml_plugin_set_value (xml_plugin_info_p pi, int depth, gccxml_attribute* a,
+                      const char* value, size_t len)
+{
+  xml_plugin_element_p pe = &pi->elements[depth];
+  if (memchr (value, '&', len))
+    {
+    char* decoded = (char*) obstack_copy0 (&pi->scratch, value, len);
+    len = xml_decode_in_place (decoded, len);
+    value = decoded;
+    }
+  a->value.data = value;
+  a->value.length = len;
+  if (a->kind == gccxml_value_id)
+    {
+    pe->element.id = a->value;
+    }
+  else if (strcmp (a->name.data, "name") == 0)
+    {
+    pe->element.name = a->value;
+    }
+}
+
+/* Start element KIND inside the innermost open element.  Its
+   attributes follow, then xml_finish_start_tag.  */
+static void
+xml_start_element (xml_dump_info_p xdi, const char* kind)
+{
+  int depth = ++xdi->depth;
+  gcc_assert (depth < XML_MAX_DEPTH);
+  xdi->open_elements[depth] = kind;
+  if (xdi->file)
+    {
+    fwrite (xml_indentation, 1, 2*depth, xdi->file);
+    putc ('<', xdi->file);
+    fputs (kind, xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    xml_plugin_start_element (xdi->plugin, depth, kind);
+    }
+}
+
+/* Finish the start tag of the innermost open element.  If EMPTY, the
+   element has no nested elements and is closed too.  */
+static void
+xml_finish_start_tag (xml_dump_info_p xdi, int empty)
+{
+  if (xdi->file)
+    {
+    fputs (empty? "/>\n" : ">\n", xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    xml_plugin_info_p pi = xdi->plugin;
+    xml_plugin_element_p pe = &pi->elements[xdi->depth];
+    pe->element.attributes = pe->attributes;
+    if (pi->callbacks.start_element)
+      {
+      pi->callbacks.start_element (pi->callbacks.data, &pe->element);
+      }
+    if (empty && pi->callbacks.end_element)
+      {
+      pi->callbacks.end_element (pi->callbacks.data, &pe->element);
+      }
+    if (empty)
+      {
+      obstack_free (&pi->scratch, pe->scratch_base);
+      }
+    }
+  if (empty)
+    {
+    --xdi->depth;
+    }
+}
+
+/* Close the innermost open element after its nested elements.  */
+static void
+xml_end_element (xml_dump_info_p xdi)
+{
+  int depth = xdi->depth--;
+  if (xdi->file)
+    {
+    fwrite (xml_indentation, 1, 2*depth, xdi->file);
+    fputs ("</", xdi->file);
+    fputs (xdi->open_elements[depth], xdi->file);
+    fputs (">\n", xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    xml_plugin_info_p pi = xdi->plugin;
+    xml_plugin_element_p pe = &pi->elements[depth];
+    if (pi->callbacks.end_element)
+      {
+      pi->callbacks.end_element (pi->callbacks.data, &pe->element);
+      }
+    obstack_free (&pi->scratch, pe->scratch_base);
+    }
+}
+
+/* Print the attribute NAME="VALUE" on the innermost open element.  */
+static void
+xml_print_attribute (xml_dump_info_p xdi, const char* name,
+                     gccxml_value_kind kind, const char* value)
+{
+  if (xdi->file)
+    {
+    putc (' ', xdi->file);
+    fputs (name, xdi->file);
+    fputs ("=\"", xdi->file);
+    fputs (value, xdi->file);
+    putc ('"', xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    gccxml_attribute* a =
+      xml_plugin_add_attribute (xdi->plugin, xdi->depth, name, kind);
+    xml_plugin_set_value (xdi->plugin, xdi->depth, a, value, strlen (value));
+    }
+}
+
+static void
+xml_print_attribute_format (xml_dump_info_p xdi, const char* name,
+                            gccxml_value_kind kind, const char* format, ...)
+  ATTRIBUTE_PRINTF_4;
+
+/* Print an attribute whose value is given by printf FORMAT.  The
+   value must be short: this is meant for numbers and ids.  */
+static void
+xml_print_attribute_format (xml_dump_info_p xdi, const char* name,
+                            gccxml_value_kind kind, const char* format, ...)
+{
+  va_list ap;
+  va_start (ap, format);
+  if (xdi->plugin)
+    {
+    xml_plugin_info_p pi = xdi->plugin;
+    gccxml_attribute* a;
+    char buffer[64];
+    int len = vsnprintf (buffer, sizeof (buffer), format, ap);
+    gcc_assert (len >= 0 && len < (int) sizeof (buffer));
+    if (xdi->file)
+      {
+      fprintf (xdi->file, " %s=\"%s\"", name, buffer);
+      }
+    a = xml_plugin_add_attribute (pi, xdi->depth, name, kind);
+    xml_plugin_set_value (pi, xdi->depth, a,
+                          (char*) obstack_copy0 (&pi->scratch, buffer, len),
+                          len);
+    }
+  else
+    {
+    putc (' ', xdi->file);
+    fputs (name, xdi->file);
+    fputs ("=\"", xdi->file);
+    vfprintf (xdi->file, format, ap);
+    putc ('"', xdi->file);
+    }
+  va_end (ap);
+}
+
+/* Begin an attribute whose value is built up piece by piece with
+   xml_append_attribute and xml_append_attribute_format, and finished
+   with xml_end_attribute.  No other output may happen meanwhile.  */
+static void
+xml_begin_attribute (xml_dump_info_p xdi, const char* name,
+                     gccxml_value_kind kind)
+{
+  if (xdi->file)
+    {
+    putc (' ', xdi->file);
+    fputs (name, xdi->file);
+    fputs ("=\"", xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    /* The value is accumulated as a growing object in the scratch
+       obstack.  */
+    xml_plugin_add_attribute (xdi->plugin, xdi->depth, name, kind);
+    }
+}
+
+/* Append the XML-encoded TEXT to the attribute being built.  */
+static void
+xml_append_attribute (xml_dump_info_p xdi, const char* text)
+{
+  if (xdi->file)
+    {
+    fputs (text, xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    obstack_grow (&xdi->plugin->scratch, text, strlen (text));
+    }
+}
+
+static void
+xml_append_attribute_format (xml_dump_info_p xdi, const char* format, ...)
+  ATTRIBUTE_PRINTF_2;
+
+/* Append a short printf-formatted piece to the attribute being
+   built.  */
+static void
+xml_append_attribute_format (xml_dump_info_p xdi, const char* format, ...)
+{
+  va_list ap;
+  va_start (ap, format);
+  if (xdi->plugin)
+    {
+    char buffer[64];
+    int len = vsnprintf (buffer, sizeof (buffer), format, ap);
+    gcc_assert (len >= 0 && len < (int) sizeof (buffer));
+    if (xdi->file)
+      {
+      fputs (buffer, xdi->file);
+      }
+    obstack_grow (&xdi->plugin->scratch, buffer, len);
+    }
+  else
+    {
+    vfprintf (xdi->file, format, ap);
+    }
+  va_end (ap);
+}
+
+/* Finish the attribute started by xml_begin_attribute.  */
+static void
+xml_end_attribute (xml_dump_info_p xdi)
+{
+  if (xdi->file)
+    {
+    putc ('"', xdi->file);
+    }
+  if (xdi->plugin)
+    {
+    xml_plugin_info_p pi = xdi->plugin;
+    xml_plugin_element_p pe = &pi->elements[xdi->depth];
+    size_t len = obstack_object_size (&pi->scratch);
+    char* value;
+    obstack_1grow (&pi->scratch, '\0');
+    value = (char*) obstack_finish (&pi->scratch);
+    xml_plugin_set_value (pi, xdi->depth,
+                          &pe->attributes[pe->element.num_attributes-1],
+                          value, len);
+    }
+}
+
+/* Load the plugin library FILENAME and let it fill in its callbacks,
+   passing it ARG.  Return 0 after reporting an error if it cannot be
+   used.  */
+static xml_plugin_info_p
+xml_load_plugin (const char* filename, const char* arg)
+{
+  const char* message = "";
+  void* handle = xml_plugin_open (filename, &message);
+  gccxml_plugin_init_function init;
+  xml_plugin_info_p pi;
+
+  if (!handle)
+    {
+    error ("could not load xml plugin %qs: %s", filename, message);
+    return 0;
+    }
+  init = (gccxml_plugin_init_function)
+    xml_plugin_symbol (handle, GCCXML_PLUGIN_INIT_SYMBOL);
+  if (!init)
+    {
+    error ("xml plugin %qs does not define %qs", filename,
+           GCCXML_PLUGIN_INIT_SYMBOL);
+    xml_plugin_close (handle);
+    return 0;
+    }
+
+  pi = XCNEW (struct xml_plugin_info);
+  pi->handle = handle;
+  if (init (GCCXML_PLUGIN_API_VERSION, arg, &pi->callbacks) != 0)
+    {
+    error ("xml plugin %qs failed to initialize", filename);
+    }
+  else if (pi->callbacks.api_version != GCCXML_PLUGIN_API_VERSION)
+    {
+    error ("xml plugin %qs was built for interface version %u, not %u",
+           filename, pi->callbacks.api_version, GCCXML_PLUGIN_API_VERSION);
+    }
+  else
+    {
+    obstack_init (&pi->scratch);
+    return pi;
+    }
+  xml_plugin_close (handle);
+  free (pi);
+  return 0;
+}
+
+/* Tell the plugin the dump is complete and unload it.  */
+static void
+xml_unload_plugin (xml_plugin_info_p pi)
+{
+  int i;
+  if (pi->callbacks.finish)
+    {
+    pi->callbacks.finish (pi->callbacks.data);
+    }
+  for (i=0; i < XML_MAX_DEPTH; ++i)
+    {
+    free (pi->elements[i].attributes);
+    }
+  obstack_free (&pi->scratch, 0);
+  xml_plugin_close (pi->handle);
+  free (pi);
+}
+
 /* Get the revision number of this source file.  */
 const char* xml_get_xml_c_version()
 {
@@ -336,40 +845,78 @@ const char* xml_get_xml_c_version()
 void
 do_xml_output (const char* filename)
 {
-  FILE* file;
+  FILE* file = 0;
+  xml_plugin_info_p plugin = 0;
   struct xml_dump_info xdi;
 
+  /* A filename of "-" sends the dump to the standard output.  */
+  int to_stdout = filename && strcmp (filename, "-") == 0;
+
   /* Do not dump if errors occurred during parsing.  */
   if(errorcount)
     {
     /* Delete any existing output file.  */
-    unlink(filename);
+    if (filename && !to_stdout)
+      {
+      unlink(filename);
+      }
     return;
     }
 
   /* Fill in the all_decls member we added to each scope.  */
   ht_forall(ident_hash, xml_fill_all_decls, 0);
 
-  /* Open the XML output file.  */
-  file = fopen (filename, "w");
-  if (!file)
+  /* Load the consumer plugin, if any.  */
+  if (flag_xml_plugin)
     {
-    error ("could not open xml-dump file `%s'", filename);
-    return;
+    plugin = xml_load_plugin (flag_xml_plugin, flag_xml_plugin_arg);
+    if (!plugin)
+      {
+      return;
+      }
+    }
+
+  /* Open the XML output file.  Without one only the plugin sees the
+     dump.  */
+  if (to_stdout)
+    {
+    file = stdout;
+    }
+  else if (filename)
+    {
+    file = fopen (filename, "w");
+    if (!file)
+      {
+      error ("could not open xml-dump file `%s'", filename);
+      if (plugin)
+        {
+        xml_unload_plugin (plugin);
+        }
+      return;
+      }
     }
 
   /* Prepare dump.  */
   xdi.file = file;
+  xdi.plugin = plugin;
+  xdi.depth = -1;
   xdi.queue = 0;
   xdi.queue_end = 0;
   xdi.queue_free = 0;
   xdi.next_index = 1;
-  xdi.dump_nodes = splay_tree_new (splay_tree_compare_pointers, 0,
-                                   (splay_tree_delete_value_fn) &free);
+  xdi.dump_node_blocks = 0;
+  xdi.num_dump_node_blocks = 0;
   xdi.file_queue = 0;
   xdi.file_queue_end = 0;
   xdi.file_index = 0;
   xdi.file_nodes = splay_tree_new (splay_tree_compare_pointers, 0, 0);
+  xdi.signatures = htab_create (64, xml_signature_hash, xml_signature_eq, 0);
+  xdi.overrides = htab_create (64, xml_overrides_hash, xml_overrides_eq,
+                               xml_overrides_free);
+  xdi.template_parm_found = 0;
+  xdi.template_parm_found_size = 0;
+  xdi.templates = 0;
+  xdi.template_set = htab_create (64, htab_hash_pointer, htab_eq_pointer, 0);
   xdi.require_complete = 1;
 
   /* Add the starting nodes for the dump.  */
@@ -391,20 +938,31 @@ do_xml_output (const char* filename)
     }
 
   /* Start dump.  */
-  fprintf (file, "<?xml version=\"1.0\"?>\n");
-  fprintf (file, "<GCC_XML");
+  if (file)
+    {
+    fprintf (file, "<?xml version=\"1.0\"?>\n");
+    }
+  xml_start_element (&xdi, "GCC_XML");
 #if defined(GCCXML_VERSION_FULL)
-  fprintf (file, " version=\"" GCCXML_VERSION_FULL "\"");
+  xml_print_attribute (&xdi, "version", gccxml_value_string,
+                       GCCXML_VERSION_FULL);
 #endif
-  fprintf (file, " cvs_revision=\"%s\"", xml_get_xml_c_version());
-  fprintf (file, ">\n");
-
-  /* Dump the complete nodes.  */
+  xml_print_attribute (&xdi, "cvs_revision", gccxml_value_string,
+                       xml_get_xml_c_version());
+  xml_finish_start_tag (&xdi, 0);
+
+  /* Dump the complete nodes.  Dumping a class may instantiate others,
+     for example when -flazy-template-members declares its member
+     functions only now, so repeat until no new instantiation shows
+     up.  */
   xml_dump (&xdi);
+  while (xml_add_late_instantiations (&xdi))
+    {
+    xml_dump (&xdi);
+    }
 
   /* Queue all the incomplete nodes.  */
-  splay_tree_foreach (xdi.dump_nodes,
-                      &xml_queue_incomplete_dump_nodes, &xdi);
+  xml_queue_incomplete_dump_nodes (&xdi);
 
   /* Dump the incomplete nodes.  */
   xdi.require_complete = 0;
@@ -414,7 +972,7 @@ do_xml_output (const char* filename)
   xml_dump_files (&xdi);
 
   /* Finish dump.  */
-  fprintf (file, "</GCC_XML>\n");
+  xml_end_element (&xdi);
 
   /* Clean up.  */
   {
@@ -426,9 +984,32 @@ do_xml_output (const char* filename)
     dq = nq;
     }
   }
-  splay_tree_delete (xdi.dump_nodes);
+  {
+  unsigned int i;
+  for (i=0; i < xdi.num_dump_node_blocks; ++i)
+    {
+    free (xdi.dump_node_blocks[i]);
+    }
+  free (xdi.dump_node_blocks);
+  }
   splay_tree_delete (xdi.file_nodes);
-  fclose (file);
+  htab_delete (xdi.signatures);
+  htab_delete (xdi.overrides);
+  free (xdi.template_parm_found);
+  VEC_free (tree, heap, xdi.templates);
+  htab_delete (xdi.template_set);
+  if (to_stdout)
+    {
+    fflush (file);
+    }
+  else if (file)
+    {
+    fclose (file);
+    }
+  if (plugin)
+    {
+    xml_unload_plugin (plugin);
+    }
 }
 
 /* Return the xml_dump_node corresponding to tree node T.  If none exists,
@@ -436,25 +1017,38 @@ do_xml_output (const char* filename)
 static xml_dump_node_p
 xml_get_dump_node(xml_dump_info_p xdi, tree t)
 {
-  /* See if the node has already been inserted.  */
-  splay_tree_node n = splay_tree_lookup (xdi->dump_nodes, (splay_tree_key) t);
-  if(!n)
-    {
-    /* Need to add the node, create it.  */
-    xml_dump_node_p v =
-      (xml_dump_node_p) xmalloc (sizeof (struct xml_dump_node));
-
-    /* Initialize it.  */
-    v->index = 0;
-    v->complete = 0;
+  unsigned int serial = TREE_SERIAL (t);
+  unsigned int block = serial / XML_DUMP_NODE_BLOCK;
+  xml_dump_node_p dn;
 
-    /* Insert the node.  */
-    n = splay_tree_insert (xdi->dump_nodes, (splay_tree_key) t,
-                           (splay_tree_value) v);
+  /* Make room for the block holding the node.  */
+  if (block >= xdi->num_dump_node_blocks)
+    {
+    unsigned int n = xdi->num_dump_node_blocks;
+    if (!n)
+      {
+      n = 16;
+      }
+    while (n <= block)
+      {
+      n *= 2;
+      }
+    xdi->dump_node_blocks = XRESIZEVEC (xml_dump_node_p,
+                                        xdi->dump_node_blocks, n);
+    memset (xdi->dump_node_blocks + xdi->num_dump_node_blocks, 0,
+            (n - xdi->num_dump_node_blocks) * sizeof (xml_dump_node_p));
+    xdi->num_dump_node_blocks = n;
+    }
+  if (!xdi->dump_node_blocks[block])
+    {
+    xdi->dump_node_blocks[block] =
+      XCNEWVEC (struct xml_dump_node, XML_DUMP_NODE_BLOCK);
     }
 
-  /* Return a pointer to the dump node.  */
-  return (xml_dump_node_p)n->value;
+  /* A new node is zero-filled.  */
+  dn = &xdi->dump_node_blocks[block][serial % XML_DUMP_NODE_BLOCK];
+  dn->tree_node = t;
+  return dn;
 }
 
 /* Queue the given tree node for output as a complete node.  */
@@ -528,18 +1122,29 @@ xml_add_node_real (xml_dump_info_p xdi, tree n, int complete)
   return dn->index;
 }
 
-/* Called for each node in the splay tree of dump nodes.  Queues
-   a dump node if it is incomplete.  */
-int xml_queue_incomplete_dump_nodes (splay_tree_node n, void* in_xdi)
+/* Queue every dump node that is incomplete, in the order the nodes
+   were first encountered.  */
+static void
+xml_queue_incomplete_dump_nodes (xml_dump_info_p xdi)
 {
-  tree key = (tree)n->key;
-  xml_dump_node_p dn = (xml_dump_node_p)n->value;
-  xml_dump_info_p xdi = (xml_dump_info_p)in_xdi;
-  if (!dn->complete)
+  unsigned int i;
+  unsigned int j;
+  for (i=0; i < xdi->num_dump_node_blocks; ++i)
     {
-    xml_queue_node (xdi, key, dn);
+    xml_dump_node_p block = xdi->dump_node_blocks[i];
+    if (!block)
+      {
+      continue;
+      }
+    for (j=0; j < XML_DUMP_NODE_BLOCK; ++j)
+      {
+      xml_dump_node_p dn = &block[j];
+      if (dn->tree_node && !dn->complete)
+        {
+        xml_queue_node (xdi, dn->tree_node, dn);
+        }
+      }
     }
-  return 0;
 }
 
 /* The xml dump loop.  */
@@ -626,8 +1231,12 @@ xml_print_location_attribute (xml_dump_info_p xdi, tree d)
   unsigned int source_file = xml_queue_file (xdi, DECL_SOURCE_FILE (d));
   unsigned int source_line = DECL_SOURCE_LINE (d);
 
-  fprintf (xdi->file, " location=\"f%d:%d\" file=\"f%d\" line=\"%d\"",
-           source_file, source_line, source_file, source_line);
+  xml_print_attribute_format (xdi, "location", gccxml_value_string,
+                              "f%d:%d", source_file, source_line);
+  xml_print_attribute_format (xdi, "file", gccxml_value_idref,
+                              "f%d", source_file);
+  xml_print_attribute_format (xdi, "line", gccxml_value_string,
+                              "%d", source_line);
 }
 
 static void
@@ -661,7 +1270,8 @@ xml_print_endline_attribute (xml_dump_info_p xdi, tree body)
     }
   if (last && EXPR_HAS_LOCATION (last))
     {
-    fprintf (xdi->file, " endline=\"%d\"", EXPR_LINENO (last));
+    xml_print_attribute_format (xdi, "endline", gccxml_value_string,
+                                "%d", EXPR_LINENO (last));
     }
 }
 
@@ -678,7 +1288,7 @@ xml_document_add_attribute_endline(xml_document_element_p element,
 static void
 xml_print_id_attribute (xml_dump_info_p xdi, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, " id=\"_%d\"", dn->index);
+  xml_print_attribute_format (xdi, "id", gccxml_value_id, "_%d", dn->index);
 }
 
 static void
@@ -695,7 +1305,7 @@ static void
 xml_print_name_attribute (xml_dump_info_p xdi, tree n)
 {
   const char* name = xml_get_encoded_string (n);
-  fprintf (xdi->file, " name=\"%s\"", name);
+  xml_print_attribute (xdi, "name", gccxml_value_string, name);
 }
 
 static void
@@ -717,7 +1327,7 @@ xml_print_mangled_attribute (xml_dump_info_p xdi, tree n)
       DECL_ASSEMBLER_NAME (n) != DECL_NAME (n))
     {
     const char* name = xml_get_encoded_string (DECL_ASSEMBLER_NAME (n));
-    fprintf (xdi->file, " mangled=\"%s\"", name);
+    xml_print_attribute (xdi, "mangled", gccxml_value_string, name);
     }
 }
 
@@ -764,7 +1374,8 @@ xml_print_demangled_attribute (xml_dump_info_p xdi, tree n)
     if(dename)
       {
       const char* encoded_dename = xml_escape_string(dename);
-      fprintf (xdi->file, " demangled=\"%s\"", encoded_dename);
+      xml_print_attribute (xdi, "demangled", gccxml_value_string,
+                           encoded_dename);
       }
     free(dupl_name);
     }
@@ -785,7 +1396,7 @@ xml_print_mutable_attribute (xml_dump_info_p xdi, tree n)
 {
   if (DECL_MUTABLE_P (n))
     {
-    fprintf (xdi->file, " mutable=\"1\"");
+    xml_print_attribute (xdi, "mutable", gccxml_value_string, "1");
     }
 }
 
@@ -870,7 +1481,7 @@ xml_print_type_idref (xml_dump_info_p xdi, tree t, int complete)
     }
 
   /* Print the reference.  */
-  fprintf (xdi->file, "_%d%s%s%s", id, c, v, r);
+  xml_append_attribute_format (xdi, "_%d%s%s%s", id, c, v, r);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -880,9 +1491,9 @@ xml_print_type_idref (xml_dump_info_p xdi, tree t, int complete)
 static void
 xml_print_type_attribute (xml_dump_info_p xdi, tree t, int complete)
 {
-  fprintf (xdi->file, " type=\"");
+  xml_begin_attribute (xdi, "type", gccxml_value_idref);
   xml_print_type_idref (xdi, t, complete);
-  fprintf (xdi->file, "\"");
+  xml_end_attribute (xdi);
 }
 
 static void
@@ -898,9 +1509,9 @@ xml_document_add_attribute_type(xml_document_element_p element)
 static void
 xml_print_returns_attribute (xml_dump_info_p xdi, tree t, int complete)
 {
-  fprintf (xdi->file, " returns=\"");
+  xml_begin_attribute (xdi, "returns", gccxml_value_idref);
   xml_print_type_idref (xdi, t, complete);
-  fprintf (xdi->file, "\"");
+  xml_end_attribute (xdi);
 }
 
 static void
@@ -916,7 +1527,8 @@ xml_document_add_attribute_returns(xml_document_element_p element)
 static void
 xml_print_base_type_attribute (xml_dump_info_p xdi, tree t, int complete)
 {
-  fprintf (xdi->file, " basetype=\"_%d\"", xml_add_node (xdi, t, complete));
+  xml_print_attribute_format (xdi, "basetype", gccxml_value_idref, "_%d",
+                              xml_add_node (xdi, t, complete));
 }
 
 static void
@@ -940,23 +1552,26 @@ xml_print_context_attribute (xml_dump_info_p xdi, tree n)
     if(context)
       {
       /* Print the context attribute.  */
-      fprintf (xdi->file, " context=\"_%d\"",
-               xml_add_node (xdi, context, 0));
+      xml_print_attribute_format (xdi, "context", gccxml_value_idref, "_%d",
+                                  xml_add_node (xdi, context, 0));
 
       /* If the context is a type, print the access attribute.  */
       if (TYPE_P(context))
         {
         if (TREE_PRIVATE (n))
           {
-          fprintf (xdi->file, " access=\"private\"");
+          xml_print_attribute (xdi, "access", gccxml_value_string,
+                               "private");
           }
         else if (TREE_PROTECTED (n))
           {
-          fprintf (xdi->file, " access=\"protected\"");
+          xml_print_attribute (xdi, "access", gccxml_value_string,
+                               "protected");
           }
         else
           {
-          fprintf (xdi->file, " access=\"public\"");
+          xml_print_attribute (xdi, "access", gccxml_value_string,
+                               "public");
           }
         }
       }
@@ -991,7 +1606,7 @@ xml_print_explicit_attribute (xml_dump_info_p xdi, tree d)
 {
   if (DECL_NONCONVERTING_P (d))
     {
-    fprintf (xdi->file, " explicit=\"1\"");
+    xml_print_attribute (xdi, "explicit", gccxml_value_string, "1");
     }
 }
 
@@ -1012,7 +1627,8 @@ xml_print_size_attribute (xml_dump_info_p xdi, tree t)
   if (size_tree && host_integerp (size_tree, 1))
     {
     unsigned HOST_WIDE_INT size = tree_low_cst (size_tree, 1);
-    fprintf (xdi->file, " size=\"" HOST_WIDE_INT_PRINT_UNSIGNED "\"", size);
+    xml_print_attribute_format (xdi, "size", gccxml_value_string,
+                                HOST_WIDE_INT_PRINT_UNSIGNED, size);
     }
 }
 
@@ -1029,7 +1645,8 @@ xml_document_add_attribute_size(xml_document_element_p element)
 static void
 xml_print_align_attribute (xml_dump_info_p xdi, tree t)
 {
-  fprintf (xdi->file, " align=\"%d\"", TYPE_ALIGN (t));
+  xml_print_attribute_format (xdi, "align", gccxml_value_string, "%d",
+                              TYPE_ALIGN (t));
 }
 
 static void
@@ -1052,8 +1669,9 @@ xml_print_offset_attribute (xml_dump_info_p xdi, tree d)
     {
     unsigned HOST_WIDE_INT bit_ofs = tree_low_cst (tree_bit_ofs, 1);
     unsigned HOST_WIDE_INT byte_ofs = tree_low_cst (tree_byte_ofs, 1);
-    fprintf(xdi->file, " offset=\"" HOST_WIDE_INT_PRINT_UNSIGNED "\"",
-            byte_ofs * 8 + bit_ofs);
+    xml_print_attribute_format (xdi, "offset", gccxml_value_string,
+                                HOST_WIDE_INT_PRINT_UNSIGNED,
+                                byte_ofs * 8 + bit_ofs);
     }
 }
 
@@ -1072,7 +1690,7 @@ xml_print_const_method_attribute (xml_dump_info_p xdi, tree fd)
 {
   if (DECL_CONST_MEMFUNC_P (fd))
     {
-    fprintf (xdi->file, " const=\"1\"");
+    xml_print_attribute (xdi, "const", gccxml_value_string, "1");
     }
 }
 
@@ -1091,7 +1709,7 @@ xml_print_static_method_attribute (xml_dump_info_p xdi, tree fd)
 {
   if (!DECL_NONSTATIC_MEMBER_FUNCTION_P (fd))
     {
-    fprintf (xdi->file, " static=\"1\"");
+    xml_print_attribute (xdi, "static", gccxml_value_string, "1");
     }
 }
 
@@ -1104,16 +1722,78 @@ xml_document_add_attribute_static_method(xml_document_element_p element)
 }
 
 /*--------------------------------------------------------------------------*/
+/* The overrides of a virtual function are found by searching each
+   base for a virtual function of the same signature and, failing
+   that, the bases of that base.  A hierarchy is searched once for
+   each signature: the result for a class is kept in xdi->overrides,
+   keyed by a representative of the signature from xdi->signatures,
+   and reused for the same signature in every class derived from it.  */
+
+/* Hash and compare virtual functions by signature, as
+   look_for_overrides_here distinguishes them: by the method slot it
+   searches, and then by same_signature_p.  */
+static hashval_t
+xml_signature_hash (const void* p)
+{
+  tree fndecl = (tree) p;
+  if (DECL_MAYBE_IN_CHARGE_DESTRUCTOR_P (fndecl))
+    {
+    return 0;
+    }
+  return htab_hash_pointer (DECL_NAME (fndecl));
+}
+
 static int
-xml_print_overrides_r (xml_dump_info_p xdi, tree type, tree fndecl);
+xml_signature_eq (const void* p1, const void* p2)
+{
+  tree f1 = (tree) p1;
+  tree f2 = (tree) p2;
+  if (DECL_MAYBE_IN_CHARGE_DESTRUCTOR_P (f1)
+      || DECL_MAYBE_IN_CHARGE_DESTRUCTOR_P (f2))
+    {
+    return (DECL_MAYBE_IN_CHARGE_DESTRUCTOR_P (f1)
+            && DECL_MAYBE_IN_CHARGE_DESTRUCTOR_P (f2));
+    }
+  return (DECL_NAME (f1) == DECL_NAME (f2)
+          && DECL_STATIC_FUNCTION_P (f1) == DECL_STATIC_FUNCTION_P (f2)
+          && same_signature_p (f1, f2));
+}
+
+static hashval_t
+xml_overrides_hash (const void* p)
+{
+  xml_overrides_entry_p e = (xml_overrides_entry_p) p;
+  return htab_hash_pointer (e->type) ^ (htab_hash_pointer (e->fndecl) * 31);
+}
 
 static int
-xml_print_overrides (xml_dump_info_p xdi, tree type, tree fndecl)
+xml_overrides_eq (const void* p1, const void* p2)
+{
+  xml_overrides_entry_p e1 = (xml_overrides_entry_p) p1;
+  xml_overrides_entry_p e2 = (xml_overrides_entry_p) p2;
+  return e1->type == e2->type && e1->fndecl == e2->fndecl;
+}
+
+static void
+xml_overrides_free (void* p)
+{
+  xml_overrides_entry_p e = (xml_overrides_entry_p) p;
+  VEC_free (tree, heap, e->overridden);
+  free (e);
+}
+
+static xml_overrides_entry_p
+xml_find_overrides_r (xml_dump_info_p xdi, tree type, tree fndecl);
+
+/* Append to *OVERRIDDEN the virtual functions FNDECL overrides in the
+   polymorphic bases of TYPE.  FNDECL represents its signature.  */
+static void
+xml_find_overrides (xml_dump_info_p xdi, tree type, tree fndecl,
+                    VEC(tree,heap) **overridden)
 {
   tree binfo = TYPE_BINFO (type);
   tree base_binfo;
   int ix;
-  int found = 0;
 
   for (ix = 0; BINFO_BASE_ITERATE (binfo, ix, base_binfo); ix++)
     {
@@ -1121,33 +1801,87 @@ xml_print_overrides (xml_dump_info_p xdi, tree type, tree fndecl)
 
     if (TYPE_POLYMORPHIC_P (basetype))
       {
-      found += xml_print_overrides_r (xdi, basetype, fndecl);
+      xml_overrides_entry_p e = xml_find_overrides_r (xdi, basetype, fndecl);
+      unsigned int i;
+      tree fn;
+      for (i = 0; VEC_iterate (tree, e->overridden, i, fn); ++i)
+        {
+        VEC_safe_push (tree, heap, *overridden, fn);
+        }
       }
     }
-  return found;
 }
 
-/* Look in TYPE for virtual functions overrides by FNDECL.  Check both
-   TYPE itself and its bases.  */
-static int
-xml_print_overrides_r (xml_dump_info_p xdi, tree type, tree fndecl)
+/* Return the entry giving the virtual functions FNDECL overrides in
+   TYPE: the one TYPE declares, or else those in its bases.  */
+static xml_overrides_entry_p
+xml_find_overrides_r (xml_dump_info_p xdi, tree type, tree fndecl)
 {
-  tree fn = look_for_overrides_here (type, fndecl);
+  struct xml_overrides_entry key;
+  xml_overrides_entry_p e;
+  hashval_t hash;
+  void** slot;
+  tree fn;
+
+  key.type = type;
+  key.fndecl = fndecl;
+  hash = xml_overrides_hash (&key);
+  e = (xml_overrides_entry_p) htab_find_with_hash (xdi->overrides, &key, hash);
+  if (e)
+    {
+    return e;
+    }
 
+  e = XNEW (struct xml_overrides_entry);
+  e->type = type;
+  e->fndecl = fndecl;
+  e->overridden = 0;
+  fn = look_for_overrides_here (type, fndecl);
   if (fn)
+    {
+    VEC_safe_push (tree, heap, e->overridden, fn);
+    }
+  else
+    {
+    /* We failed to find one declared in this class. Look in its bases.
+       This adds the entries of the bases first, so the slot is found
+       only afterward.  */
+    xml_find_overrides (xdi, type, fndecl, &e->overridden);
+    }
+
+  slot = htab_find_slot_with_hash (xdi->overrides, e, hash, INSERT);
+  *slot = e;
+  return e;
+}
+
+/* Print the ids of the virtual functions FNDECL overrides in the bases
+   of TYPE.  */
+static void
+xml_print_overrides (xml_dump_info_p xdi, tree type, tree fndecl)
+{
+  VEC(tree,heap) *overridden = 0;
+  void** slot;
+  unsigned int i;
+  tree fn;
+
+  /* Use the representative of the signature of FNDECL.  */
+  slot = htab_find_slot (xdi->signatures, fndecl, INSERT);
+  if (!*slot)
+    {
+    *slot = fndecl;
+    }
+
+  xml_find_overrides (xdi, type, (tree) *slot, &overridden);
+  for (i = 0; VEC_iterate (tree, overridden, i, fn); ++i)
     {
     int id = xml_add_node (xdi, fn, 1);
 
     if(id)
       {
-      fprintf (xdi->file, "_%d ", id);
+      xml_append_attribute_format (xdi, "_%d ", id);
       }
-
-    return 1;
     }
-
-  /* We failed to find one declared in this class. Look in its bases.  */
-  return xml_print_overrides (xdi, type, fndecl);
+  VEC_free (tree, heap, overridden);
 }
 
 static void
@@ -1155,9 +1889,14 @@ xml_print_overrides_method_attribute (xml_dump_info_p xdi, tree d)
 {
   if (DECL_VIRTUAL_P (d))
     {
-    fprintf (xdi->file, " overrides=\"");
-    xml_print_overrides(xdi, CP_DECL_CONTEXT(d), d);
-    fprintf (xdi->file, "\"");
+    xml_begin_attribute (xdi, "overrides", gccxml_value_idrefs);
+    /* The search finds nothing for a function that overrides nothing,
+       but it would search the whole hierarchy to find that out.  */
+    if (DECL_OVERRIDES_P (d))
+      {
+      xml_print_overrides(xdi, CP_DECL_CONTEXT(d), d);
+      }
+    xml_end_attribute (xdi);
     }
 }
 
@@ -1177,12 +1916,12 @@ xml_print_virtual_method_attributes (xml_dump_info_p xdi, tree d)
 {
   if (DECL_VIRTUAL_P (d))
     {
-    fprintf (xdi->file, " virtual=\"1\"");
+    xml_print_attribute (xdi, "virtual", gccxml_value_string, "1");
     }
 
   if (DECL_PURE_VIRTUAL_P (d))
     {
-    fprintf (xdi->file, " pure_virtual=\"1\"");
+    xml_print_attribute (xdi, "pure_virtual", gccxml_value_string, "1");
     }
 
   xml_print_overrides_method_attribute(xdi, d);
@@ -1207,7 +1946,7 @@ xml_print_extern_attribute (xml_dump_info_p xdi, tree d)
 {
   if (DECL_EXTERNAL (d))
     {
-    fprintf (xdi->file, " extern=\"1\"");
+    xml_print_attribute (xdi, "extern", gccxml_value_string, "1");
     }
 }
 
@@ -1226,7 +1965,7 @@ xml_print_inline_attribute (xml_dump_info_p xdi, tree d)
 {
   if (DECL_DECLARED_INLINE_P (d))
     {
-    fprintf (xdi->file, " inline=\"1\"");
+    xml_print_attribute (xdi, "inline", gccxml_value_string, "1");
     }
 }
 
@@ -1245,7 +1984,7 @@ xml_print_function_extern_attribute (xml_dump_info_p xdi, tree fd)
 {
   if (DECL_REALLY_EXTERN (fd))
     {
-    fprintf (xdi->file, " extern=\"1\"");
+    xml_print_attribute (xdi, "extern", gccxml_value_string, "1");
     }
 }
 
@@ -1264,7 +2003,7 @@ xml_print_default_argument_attribute (xml_dump_info_p xdi, tree t)
 {
   const char* value;
   value = xml_get_encoded_string_from_string (expr_as_string (t, 0));
-  fprintf (xdi->file, " default=\"%s\"", value);
+  xml_print_attribute (xdi, "default", gccxml_value_string, value);
 }
 
 static void
@@ -1276,6 +2015,67 @@ xml_document_add_attribute_default_argument(xml_document_element_p element,
 }
 
 /*--------------------------------------------------------------------------*/
+/* Return initializer T with each STRING_CST that reshape_init made of
+   a list of integer constants (INITIALIZER_LIST_STRING_P) replaced by
+   the CONSTRUCTOR it would otherwise have built, so the init attribute
+   prints the list as written.  */
+static tree
+xml_expand_initializer_strings (tree t)
+{
+  if (TREE_CODE (t) == STRING_CST && INITIALIZER_LIST_STRING_P (t))
+    {
+    /* Convert each distinct byte once, the way digest_init converts
+       an element of the list.  */
+    tree values[1 << BITS_PER_UNIT];
+    tree elt_type = TREE_TYPE (TREE_TYPE (t));
+    const unsigned char* bytes =
+      (const unsigned char*) TREE_STRING_POINTER (t);
+    int length = TREE_STRING_LENGTH (t);
+    VEC(constructor_elt,gc)* v = VEC_alloc (constructor_elt, gc, length);
+    int i;
+    memset (values, 0, sizeof (values));
+    for (i = 0; i < length; ++i)
+      {
+      tree value = values[bytes[i]];
+      if (!value)
+        {
+        HOST_WIDE_INT n = (TYPE_UNSIGNED (elt_type)
+                           ? (HOST_WIDE_INT) bytes[i]
+                           : (HOST_WIDE_INT) (signed char) bytes[i]);
+        value = digest_init (elt_type, build_int_cst (integer_type_node, n));
+        values[bytes[i]] = value;
+        }
+      CONSTRUCTOR_APPEND_ELT (v, NULL_TREE, value);
+      }
+    return build_constructor (TREE_TYPE (t), v);
+    }
+  else if (TREE_CODE (t) == CONSTRUCTOR)
+    {
+    /* Copy the CONSTRUCTOR only if one of its elements changes.  */
+    VEC(constructor_elt,gc)* elts = CONSTRUCTOR_ELTS (t);
+    VEC(constructor_elt,gc)* v = 0;
+    constructor_elt* ce;
+    unsigned int i;
+    for (i = 0; VEC_iterate (constructor_elt, elts, i, ce); ++i)
+      {
+      tree value = xml_expand_initializer_strings (ce->value);
+      if (value != ce->value && !v)
+        {
+        v = VEC_copy (constructor_elt, gc, elts);
+        }
+      if (v)
+        {
+        VEC_index (constructor_elt, v, i)->value = value;
+        }
+      }
+    if (v)
+      {
+      t = build_constructor (TREE_TYPE (t), v);
+      }
+    }
+  return t;
+}
+
 /* Print XML attribute init="..." for a variable initializer.  */
 static void
 xml_print_init_attribute (xml_dump_info_p xdi, tree t)
@@ -1284,8 +2084,9 @@ xml_print_init_attribute (xml_dump_info_p xdi, tree t)
 
   if (!t || (t == error_mark_node)) return;
 
+  t = xml_expand_initializer_strings (t);
   value = xml_get_encoded_string_from_string (expr_as_string (t, 0));
-  fprintf (xdi->file, " init=\"%s\"", value);
+  xml_print_attribute (xdi, "init", gccxml_value_string, value);
 }
 
 static void
@@ -1303,7 +2104,7 @@ xml_print_incomplete_attribute (xml_dump_info_p xdi, tree t)
 {
   if (!COMPLETE_TYPE_P (t))
     {
-    fprintf (xdi->file, " incomplete=\"1\"");
+    xml_print_attribute (xdi, "incomplete", gccxml_value_string, "1");
     }
 }
 
@@ -1322,7 +2123,7 @@ xml_print_abstract_attribute (xml_dump_info_p xdi, tree t)
 {
   if (CLASSTYPE_PURE_VIRTUALS (t) != 0)
     {
-    fprintf (xdi->file, " abstract=\"1\"");
+    xml_print_attribute (xdi, "abstract", gccxml_value_string, "1");
     }
 }
 
@@ -1339,8 +2140,8 @@ xml_document_add_attribute_abstract(xml_document_element_p element)
 static void
 xml_output_ellipsis (xml_dump_info_p xdi)
 {
-  fprintf (xdi->file,
-           "    <Ellipsis/>\n");
+  xml_start_element (xdi, "Ellipsis");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -1362,7 +2163,8 @@ xml_print_array_attributes (xml_dump_info_p xdi, tree at)
     length = xml_get_encoded_string_from_string (
       expr_as_string (TYPE_MAX_VALUE (TYPE_DOMAIN (at)), 0));
 
-  fprintf (xdi->file, " min=\"0\" max=\"%s\"", length);
+  xml_print_attribute (xdi, "min", gccxml_value_string, "0");
+  xml_print_attribute (xdi, "max", gccxml_value_string, length);
 }
 
 static void
@@ -1384,18 +2186,18 @@ xml_print_throw_attribute (xml_dump_info_p xdi, tree ft, int complete)
   tree raises = TYPE_RAISES_EXCEPTIONS (ft);
   if(raises)
     {
-    fprintf (xdi->file, " throw=\"");
+    xml_begin_attribute (xdi, "throw", gccxml_value_idrefs);
     if(TREE_VALUE (raises))
       {
       for (;
            raises != NULL_TREE; raises = TREE_CHAIN (raises))
         {
-        fprintf (xdi->file, "%s",
-                 (raises == TYPE_RAISES_EXCEPTIONS (ft))?"":" ");
+        xml_append_attribute (xdi,
+                              (raises == TYPE_RAISES_EXCEPTIONS (ft))?"":" ");
         xml_print_type_idref (xdi, TREE_VALUE (raises), complete);
         }
       }
-    fprintf (xdi->file, "\"");
+    xml_end_attribute (xdi);
     }
 }
 
@@ -1458,46 +2260,54 @@ xml_print_attributes_attribute (xml_dump_info_p xdi, tree attributes1,
     tree attribute;
     tree arg_node;
     char* arg;
-    fprintf(xdi->file, " attributes=\"");
+    xml_begin_attribute (xdi, "attributes", gccxml_value_string);
     for(attribute = attributes1; attribute;
         attribute = TREE_CHAIN(attribute))
       {
-      fprintf(xdi->file, "%s%s", space,
-              xml_get_encoded_string(TREE_PURPOSE (attribute)));
+      xml_append_attribute (xdi, space);
+      xml_append_attribute (xdi,
+                            xml_get_encoded_string(TREE_PURPOSE (attribute)));
       space = " ";
 
       /* Format and print the string arguments to the attribute
          (contributed by Steven Kilthau - May 2004).  */
       if ((arg_node = xml_get_first_attrib_arg(attribute, &arg)) != 0)
         {
-        fprintf(xdi->file, "(%s", xml_get_encoded_string_from_string(arg));
+        xml_append_attribute (xdi, "(");
+        xml_append_attribute (xdi, xml_get_encoded_string_from_string(arg));
         while((arg_node = xml_get_next_attrib_arg(arg_node, &arg)) != 0)
           {
-          fprintf(xdi->file, ",%s", xml_get_encoded_string_from_string(arg));
+          xml_append_attribute (xdi, ",");
+          xml_append_attribute (xdi,
+                                xml_get_encoded_string_from_string(arg));
           }
-        fprintf(xdi->file, ")");
+        xml_append_attribute (xdi, ")");
         }
       }
     for(attribute = attributes2; attribute;
         attribute = TREE_CHAIN(attribute))
       {
-      fprintf(xdi->file, "%s%s", space,
-              xml_get_encoded_string(TREE_PURPOSE (attribute)));
+      xml_append_attribute (xdi, space);
+      xml_append_attribute (xdi,
+                            xml_get_encoded_string(TREE_PURPOSE (attribute)));
       space = " ";
 
       /* Format and print the string arguments to the attribute
          (contributed by Steven Kilthau - May 2004).  */
       if ((arg_node = xml_get_first_attrib_arg(attribute, &arg)) != 0)
         {
-        fprintf(xdi->file, "(%s", xml_get_encoded_string_from_string(arg));
+        xml_append_attribute (xdi, "(");
+        xml_append_attribute (xdi, xml_get_encoded_string_from_string(arg));
         while((arg_node = xml_get_next_attrib_arg(arg_node, &arg)) != 0)
           {
-          fprintf(xdi->file, ",%s", xml_get_encoded_string_from_string(arg));
+          xml_append_attribute (xdi, ",");
+          xml_append_attribute (xdi,
+                                xml_get_encoded_string_from_string(arg));
           }
-        fprintf(xdi->file, ")");
+        xml_append_attribute (xdi, ")");
         }
       }
-    fprintf(xdi->file, "\"");
+    xml_end_attribute (xdi);
     }
 }
 
@@ -1516,7 +2326,7 @@ xml_print_artificial_attribute(xml_dump_info_p xdi, tree d)
 {
   if (DECL_ARTIFICIAL (d))
     {
-    fprintf (xdi->file, " artificial=\"1\"");
+    xml_print_attribute (xdi, "artificial", gccxml_value_string, "1");
     }
 }
 
@@ -1540,7 +2350,8 @@ xml_print_bits_attribute (xml_dump_info_p xdi, tree d)
     if (size_tree && host_integerp (size_tree, 1))
       {
       unsigned HOST_WIDE_INT bits = tree_low_cst(size_tree, 1);
-      fprintf (xdi->file, " bits=\"" HOST_WIDE_INT_PRINT_UNSIGNED "\"", bits);
+      xml_print_attribute_format (xdi, "bits", gccxml_value_string,
+                                  HOST_WIDE_INT_PRINT_UNSIGNED, bits);
       }
     }
 }
@@ -1571,17 +2382,17 @@ xml_print_befriending_attribute (xml_dump_info_p xdi, tree befriending)
   if(have_befriending)
     {
     const char* sep = "";
-    fprintf (xdi->file, " befriending=\"");
+    xml_begin_attribute (xdi, "befriending", gccxml_value_idrefs);
     for (frnd = befriending ; frnd ; frnd = TREE_CHAIN (frnd))
       {
       if(TREE_CODE (TREE_VALUE (frnd)) != TEMPLATE_DECL)
         {
-        fprintf (xdi->file,
-                 "%s_%d", sep, xml_add_node (xdi, TREE_VALUE (frnd), 0));
+        xml_append_attribute_format (xdi, "%s_%d", sep,
+                                     xml_add_node (xdi, TREE_VALUE (frnd), 0));
         sep = " ";
         }
       }
-    fprintf (xdi->file, "\"");
+    xml_end_attribute (xdi);
     }
 }
 
@@ -1601,18 +2412,22 @@ xml_output_unimplemented (xml_dump_info_p xdi, tree t, xml_dump_node_p dn,
                           const char* where)
 {
   int tree_code = TREE_CODE (t);
-  fprintf (xdi->file, "  <Unimplemented");
+  xml_start_element (xdi, "Unimplemented");
   if(dn)
     {
-    fprintf (xdi->file, " id=\"_%d\"", dn->index);
+    xml_print_id_attribute (xdi, dn);
     }
-  fprintf (xdi->file, " tree_code=\"%d\" tree_code_name=\"%s\" node=\"%p\"",
-           tree_code, tree_code_name [tree_code], t);
+  xml_print_attribute_format (xdi, "tree_code", gccxml_value_string, "%d",
+                              tree_code);
+  xml_print_attribute (xdi, "tree_code_name", gccxml_value_string,
+                       tree_code_name [tree_code]);
+  xml_print_attribute_format (xdi, "node", gccxml_value_string, "%p",
+                              (void*) t);
   if (where)
     {
-    fprintf (xdi->file, " function=\"%s\"", where);
+    xml_print_attribute (xdi, "function", gccxml_value_string, where);
     }
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -1645,7 +2460,7 @@ xml_output_namespace_decl (xml_dump_info_p xdi, tree ns, xml_dump_node_p dn)
   /* Only walk a real namespace.  */
   if (!DECL_NAMESPACE_ALIAS (ns))
     {
-    fprintf (xdi->file, "  <Namespace");
+    xml_start_element (xdi, "Namespace");
     xml_print_id_attribute (xdi, dn);
     if(DECL_NAME (ns) != NULL_TREE) /* anonymous_namespace_name */
       {
@@ -1664,21 +2479,21 @@ xml_output_namespace_decl (xml_dump_info_p xdi, tree ns, xml_dump_node_p dn)
       int len = VEC_length (tree, decls);
 
       /* Output all the declarations.  */
-      fprintf (xdi->file, " members=\"");
+      xml_begin_attribute (xdi, "members", gccxml_value_idrefs);
       for (i=0; i < len; ++i)
         {
         int id = xml_add_node (xdi, vec[i], 1);
         if (id)
           {
-          fprintf (xdi->file, "_%d ", id);
+          xml_append_attribute_format (xdi, "_%d ", id);
           }
         }
-      fprintf (xdi->file, "\"");
+      xml_end_attribute (xdi);
       }
 
     xml_print_mangled_attribute (xdi, ns);
     xml_print_demangled_attribute (xdi, ns);
-    fprintf (xdi->file, "/>\n");
+    xml_finish_start_tag (xdi, 1);
     }
   /* If it is a namespace alias, just indicate that.  */
   else
@@ -1690,15 +2505,15 @@ xml_output_namespace_decl (xml_dump_info_p xdi, tree ns, xml_dump_node_p dn)
       real_ns = DECL_NAMESPACE_ALIAS (real_ns);
       }
 
-    fprintf (xdi->file, "  <NamespaceAlias");
+    xml_start_element (xdi, "NamespaceAlias");
     xml_print_id_attribute (xdi, dn);
     xml_print_name_attribute (xdi, DECL_NAME (ns));
     xml_print_context_attribute (xdi, ns);
-    fprintf (xdi->file, " namespace=\"_%d\"",
-             xml_add_node (xdi, real_ns, 0));
+    xml_print_attribute_format (xdi, "namespace", gccxml_value_idref, "_%d",
+                                xml_add_node (xdi, real_ns, 0));
     xml_print_mangled_attribute (xdi, ns);
     xml_print_demangled_attribute (xdi, ns );
-    fprintf (xdi->file, "/>\n");
+    xml_finish_start_tag (xdi, 1);
     }
 }
 
@@ -1740,7 +2555,7 @@ xml_document_add_element_namespace_decl (xml_document_info_p xdi,
 static void
 xml_output_typedef (xml_dump_info_p xdi, tree td, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <Typedef");
+  xml_start_element (xdi, "Typedef");
   xml_print_id_attribute (xdi, dn);
   xml_print_name_attribute (xdi, DECL_NAME (td));
 
@@ -1763,7 +2578,7 @@ xml_output_typedef (xml_dump_info_p xdi, tree td, xml_dump_node_p dn)
     xml_print_attributes_attribute (xdi, DECL_ATTRIBUTES(td), 0);
     }
 
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -1790,7 +2605,7 @@ xml_output_argument (xml_dump_info_p xdi, tree pd, tree tl, int complete)
      things like constructors of classes with virtual inheritance.  */
   if (pd && DECL_ARTIFICIAL (pd)) return;
 
-  fprintf (xdi->file, "    <Argument");
+  xml_start_element (xdi, "Argument");
 
   if (pd && DECL_NAME (pd))
     {
@@ -1824,7 +2639,7 @@ xml_output_argument (xml_dump_info_p xdi, tree pd, tree tl, int complete)
     xml_print_attributes_attribute (xdi, DECL_ATTRIBUTES(pd), 0);
     }
 
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -1942,7 +2757,7 @@ xml_output_function_decl (xml_dump_info_p xdi, tree fd, xml_dump_node_p dn)
       }
     }
 
-  fprintf (xdi->file, "  <%s", tag);
+  xml_start_element (xdi, tag);
   xml_print_id_attribute (xdi, dn);
   if(do_name)
     {
@@ -1986,12 +2801,12 @@ xml_output_function_decl (xml_dump_info_p xdi, tree fd, xml_dump_node_p dn)
   /* If there are no arguments, finish the element.  */
   if (arg_type == void_list_node)
     {
-    fprintf (xdi->file, "/>\n");
+    xml_finish_start_tag (xdi, 1);
     return;
     }
   else
     {
-    fprintf (xdi->file, ">\n");
+    xml_finish_start_tag (xdi, 0);
     }
 
   /* Print out the argument list for this function.  */
@@ -2008,7 +2823,7 @@ xml_output_function_decl (xml_dump_info_p xdi, tree fd, xml_dump_node_p dn)
     xml_output_ellipsis (xdi);
     }
 
-  fprintf (xdi->file, "  </%s>\n", tag);
+  xml_end_element (xdi);
 }
 
 static void
@@ -2115,7 +2930,7 @@ static void
 xml_output_var_decl (xml_dump_info_p xdi, tree vd, xml_dump_node_p dn)
 {
   tree type = TREE_TYPE (vd);
-  fprintf (xdi->file, "  <Variable");
+  xml_start_element (xdi, "Variable");
   xml_print_id_attribute (xdi, dn);
   xml_print_name_attribute (xdi, DECL_NAME (vd));
   xml_print_type_attribute (xdi, type, dn->complete);
@@ -2127,7 +2942,7 @@ xml_output_var_decl (xml_dump_info_p xdi, tree vd, xml_dump_node_p dn)
   xml_print_extern_attribute (xdi, vd);
   xml_print_artificial_attribute (xdi, vd);
   xml_print_attributes_attribute (xdi, DECL_ATTRIBUTES(vd), 0);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2156,7 +2971,7 @@ xml_document_add_element_var_decl (xml_document_info_p xdi,
 static void
 xml_output_field_decl (xml_dump_info_p xdi, tree fd, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <Field");
+  xml_start_element (xdi, "Field");
   xml_print_id_attribute (xdi, dn);
   xml_print_name_attribute (xdi, DECL_NAME (fd));
   xml_print_bits_attribute(xdi, fd);
@@ -2175,7 +2990,7 @@ xml_output_field_decl (xml_dump_info_p xdi, tree fd, xml_dump_node_p dn)
   xml_print_mutable_attribute(xdi, fd);
   xml_print_location_attribute (xdi, fd);
   xml_print_attributes_attribute (xdi, DECL_ATTRIBUTES(fd), 0);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2198,6 +3013,58 @@ xml_document_add_element_field_decl (xml_document_info_p xdi,
   xml_document_add_attribute_attributes(e);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Hook to suppress diagnostic messages during synthesize test.  */
+extern int diagnostic_xml_synthesize_test;
+
+/* Return whether FD is a compiler-generated function that has not been
+   defined yet.  It must be synthesized to find out whether it is
+   valid.  */
+static int
+xml_synthesis_needed_p (tree fd)
+{
+  return (DECL_ARTIFICIAL (fd) && !DECL_INITIAL (fd) &&
+          (!DECL_REALLY_EXTERN (fd) || DECL_INLINE (fd)));
+}
+
+/* Every this many syntheses, finishing the synthesized function may
+   collect garbage.  */
+#define XML_SYNTHESIS_COLLECT_INTERVAL 4096
+
+/* Synthesize the compiler-generated function FD.  An error marks it
+   with GCCXML_DECL_ERROR instead of being reported.  */
+static void
+xml_synthesize_test (tree fd)
+{
+  static unsigned int syntheses;
+  int collect;
+
+  /* We try to synthesize this function but suppress error messages.  */
+  diagnostic_xml_synthesize_test = 1;
+
+  /* Taken from cp_finish_file.  Finishing the function collects
+     garbage whenever the heap has grown enough, which during the dump
+     costs more than it frees, since the dump keeps what it has seen.
+     Raising the function depth prevents that, as when synthesizing
+     for a default argument, except every
+     XML_SYNTHESIS_COLLECT_INTERVAL syntheses and while the heap is
+     past ggc_heap_ceiling, so the garbage of synthesis cannot pile up
+     without bound.  */
+  collect = (++syntheses % XML_SYNTHESIS_COLLECT_INTERVAL == 0
+             || ggc_heap_size () / 1024 > ggc_heap_ceiling ());
+  push_to_top_level ();
+  input_location = DECL_SOURCE_LOCATION (fd);
+  if (!collect)
+    ++function_depth;
+  synthesize_method (fd);
+  if (!collect)
+    --function_depth;
+  pop_from_top_level ();
+
+  /* Error messages have been converted to GCCXML_DECL_ERROR marks.  */
+  diagnostic_xml_synthesize_test = 0;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Output a RECORD_TYPE that is not a pointer-to-member-function.
    Prints beginning and ending tags, and all class member declarations
@@ -2217,7 +3084,7 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
     }
   else { tag = "Union"; }
 
-  fprintf (xdi->file, "  <%s", tag);
+  xml_start_element (xdi, tag);
   xml_print_id_attribute (xdi, dn);
   if(!TYPE_ANONYMOUS_P (rt))
     {
@@ -2237,7 +3104,13 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
 
   if (dn->complete && COMPLETE_TYPE_P (rt))
     {
-    fprintf (xdi->file, " members=\"");
+    /* Instantiate any member functions of a class template
+       instantiation that have not been needed yet.  */
+    if (CLASS_TYPE_P (rt) && CLASSTYPE_LAZY_MEMBERS (rt))
+      {
+      instantiate_lazy_members (rt, NULL_TREE);
+      }
+    xml_begin_attribute (xdi, "members", gccxml_value_idrefs);
     /* Output all the non-method declarations in the class.  */
     for (field = TYPE_FIELDS (rt) ; field ; field = TREE_CHAIN (field))
       {
@@ -2252,7 +3125,7 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
         int id = xml_add_node (xdi, field, 1);
         if (id)
           {
-          fprintf (xdi->file, "_%d ", id);
+          xml_append_attribute_format (xdi, "_%d ", id);
           }
         }
       }
@@ -2275,13 +3148,13 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
       id = xml_add_node (xdi, func, 1);
       if(id)
         {
-        fprintf (xdi->file, "_%d ", id);
+        xml_append_attribute_format (xdi, "_%d ", id);
         }
       }
 
     /* TODO: List member template instantiations as members.  */
 
-    fprintf (xdi->file, "\"");
+    xml_end_attribute (xdi);
     }
 
   /* Output all the base classes (compatibility with gccxml 0.6).  */
@@ -2293,7 +3166,7 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
     int i;
 
     has_bases = (n_baselinks > 0)? 1:0;
-    fprintf (xdi->file, " bases=\"");
+    xml_begin_attribute (xdi, "bases", gccxml_value_idrefs);
     for (i = 0; i < n_baselinks; i++)
       {
       tree base_binfo = BINFO_BASE_BINFO(binfo, i);
@@ -2306,22 +3179,23 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
         if (n_access == access_protected_node) { access = "protected:"; }
         else if (n_access == access_private_node) { access = "private:"; }
 
-        fprintf (xdi->file, "%s_%d ", access,
-                 xml_add_node (xdi, BINFO_TYPE (base_binfo), 1));
+        xml_append_attribute_format (
+          xdi, "%s_%d ", access,
+          xml_add_node (xdi, BINFO_TYPE (base_binfo), 1));
         }
       }
-    fprintf (xdi->file, "\"");
+    xml_end_attribute (xdi);
     }
 
   /* If there were no base classes, end the element now.  */
   if(!has_bases)
     {
-    fprintf (xdi->file, "/>\n");
+    xml_finish_start_tag (xdi, 1);
     return;
     }
 
   /* There are base classes.  Open the element for nested elements.  */
-  fprintf (xdi->file, ">\n");
+  xml_finish_start_tag (xdi, 0);
 
   /* Output all the base classes.  */
   if (dn->complete && COMPLETE_TYPE_P (rt) && TYPE_BINFO (rt))
@@ -2344,17 +3218,22 @@ xml_output_record_type (xml_dump_info_p xdi, tree rt, xml_dump_node_p dn)
         if (n_access == access_protected_node) { access = "protected"; }
         else if (n_access == access_private_node) { access = "private"; }
 
-        fprintf (xdi->file,
-                 "    <Base type=\"_%d\" access=\"%s\" virtual=\"%d\""
-                 " offset=\"%d\"/>\n",
-                 xml_add_node (xdi, BINFO_TYPE (base_binfo), 1),
-                 access, is_virtual,
-                 tree_low_cst (BINFO_OFFSET (base_binfo), 0));
+        xml_start_element (xdi, "Base");
+        xml_print_attribute_format (
+          xdi, "type", gccxml_value_idref, "_%d",
+          xml_add_node (xdi, BINFO_TYPE (base_binfo), 1));
+        xml_print_attribute (xdi, "access", gccxml_value_string, access);
+        xml_print_attribute (xdi, "virtual", gccxml_value_string,
+                             is_virtual? "1" : "0");
+        xml_print_attribute_format (
+          xdi, "offset", gccxml_value_string, "%d",
+          (int) tree_low_cst (BINFO_OFFSET (base_binfo), 0));
+        xml_finish_start_tag (xdi, 1);
         }
       }
     }
 
-  fprintf (xdi->file, "  </%s>\n", tag);
+  xml_end_element (xdi);
 }
 
 static void
@@ -2417,7 +3296,7 @@ xml_document_add_element_record_type (xml_document_info_p xdi,
 static void
 xml_output_fundamental_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <FundamentalType");
+  xml_start_element (xdi, "FundamentalType");
   xml_print_id_attribute (xdi, dn);
   /* Some fundamental types do not have names!  */
   if (TYPE_NAME (t))
@@ -2427,7 +3306,7 @@ xml_output_fundamental_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2450,11 +3329,11 @@ xml_output_function_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
   tree arg_type;
 
-  fprintf (xdi->file, "  <FunctionType");
+  xml_start_element (xdi, "FunctionType");
   xml_print_id_attribute (xdi, dn);
   xml_print_returns_attribute (xdi, TREE_TYPE (t), dn->complete);
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
-  fprintf (xdi->file, ">\n");
+  xml_finish_start_tag (xdi, 0);
 
   /* Prepare to iterator through argument list.  */
   arg_type = TYPE_ARG_TYPES (t);
@@ -2472,7 +3351,7 @@ xml_output_function_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
     xml_output_ellipsis (xdi);
     }
 
-  fprintf (xdi->file, "  </FunctionType>\n");
+  xml_end_element (xdi);
 }
 
 static void
@@ -2496,7 +3375,7 @@ xml_output_method_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
   tree arg_type;
   tree this_type;
 
-  fprintf (xdi->file, "  <MethodType");
+  xml_start_element (xdi, "MethodType");
   xml_print_id_attribute (xdi, dn);
   xml_print_base_type_attribute (xdi, TYPE_METHOD_BASETYPE (t), dn->complete);
   xml_print_returns_attribute (xdi, TREE_TYPE (t), dn->complete);
@@ -2512,15 +3391,15 @@ xml_output_method_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
     {
     if (TYPE_READONLY (this_type))
       {
-      fprintf (xdi->file, " const=\"1\"");
+      xml_print_attribute (xdi, "const", gccxml_value_string, "1");
       }
     if (TYPE_VOLATILE (this_type))
       {
-      fprintf (xdi->file, " volatile=\"1\"");
+      xml_print_attribute (xdi, "volatile", gccxml_value_string, "1");
       }
     }
 
-  fprintf (xdi->file, ">\n");
+  xml_finish_start_tag (xdi, 0);
 
   /* Skip "this" argument.  */
   arg_type = TREE_CHAIN (arg_type);
@@ -2538,7 +3417,7 @@ xml_output_method_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
     xml_output_ellipsis (xdi);
     }
 
-  fprintf (xdi->file, "  </MethodType>\n");
+  xml_end_element (xdi);
 }
 
 static void
@@ -2566,13 +3445,13 @@ xml_document_add_element_method_type (xml_document_info_p xdi,
 static void
 xml_output_pointer_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <PointerType");
+  xml_start_element (xdi, "PointerType");
   xml_print_id_attribute (xdi, dn);
   xml_print_type_attribute (xdi, TREE_TYPE (t), 0);
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2593,13 +3472,13 @@ xml_document_add_element_pointer_type (xml_document_info_p xdi,
 static void
 xml_output_reference_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <ReferenceType");
+  xml_start_element (xdi, "ReferenceType");
   xml_print_id_attribute (xdi, dn);
   xml_print_type_attribute (xdi, TREE_TYPE (t), 0);
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2620,14 +3499,14 @@ xml_document_add_element_reference_type (xml_document_info_p xdi,
 static void
 xml_output_offset_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <OffsetType");
+  xml_start_element (xdi, "OffsetType");
   xml_print_id_attribute (xdi, dn);
   xml_print_base_type_attribute (xdi, TYPE_OFFSET_BASETYPE (t), dn->complete);
   xml_print_type_attribute (xdi, TREE_TYPE (t), dn->complete);
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2649,14 +3528,14 @@ xml_document_add_element_offset_type (xml_document_info_p xdi,
 static void
 xml_output_array_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
-  fprintf (xdi->file, "  <ArrayType");
+  xml_start_element (xdi, "ArrayType");
   xml_print_id_attribute (xdi, dn);
   xml_print_array_attributes (xdi, t);
   xml_print_type_attribute (xdi, TREE_TYPE (t), dn->complete);
   xml_print_attributes_attribute (xdi, TYPE_ATTRIBUTES(t), 0);
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, "/>\n");
+  xml_finish_start_tag (xdi, 1);
 }
 
 static void
@@ -2680,7 +3559,7 @@ xml_output_enumeral_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 {
   tree tv;
 
-  fprintf (xdi->file, "  <Enumeration");
+  xml_start_element (xdi, "Enumeration");
   xml_print_id_attribute (xdi, dn);
   xml_print_name_attribute (xdi, DECL_NAME (TYPE_NAME (t)));
   xml_print_context_attribute (xdi, TYPE_NAME (t));
@@ -2689,7 +3568,7 @@ xml_output_enumeral_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
   xml_print_artificial_attribute (xdi, TYPE_NAME (t));
   xml_print_size_attribute (xdi, t);
   xml_print_align_attribute (xdi, t);
-  fprintf (xdi->file, ">\n");
+  xml_finish_start_tag (xdi, 0);
 
   /* Output the list of possible values for the enumeration type.  */
   for (tv = TYPE_VALUES (t); tv ; tv = TREE_CHAIN (tv))
@@ -2697,19 +3576,21 @@ xml_output_enumeral_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
     if(TREE_CODE (TREE_VALUE (tv)) == INTEGER_CST)
       {
       int value = TREE_INT_CST_LOW (TREE_VALUE (tv));
-      fprintf (xdi->file,
-               "    <EnumValue name=\"%s\" init=\"%d\"/>\n",
-               xml_get_encoded_string ( TREE_PURPOSE(tv)), value);
+      xml_start_element (xdi, "EnumValue");
+      xml_print_attribute (xdi, "name", gccxml_value_string,
+                           xml_get_encoded_string ( TREE_PURPOSE(tv)));
+      xml_print_attribute_format (xdi, "init", gccxml_value_string, "%d",
+                                  value);
+      xml_finish_start_tag (xdi, 1);
       }
     else
       {
-      fprintf (xdi->file, "  ");
       xml_output_unimplemented (xdi, TREE_VALUE (tv), 0,
                                 "xml_output_enumeral_type");
       }
     }
 
-  fprintf (xdi->file, "  </Enumeration>\n");
+  xml_end_element (xdi);
 }
 
 static void
@@ -2811,26 +3692,27 @@ xml_output_cv_qualified_type (xml_dump_info_p xdi, tree t, xml_dump_node_p dn)
 
     /* Create a special CvQualifiedType element to hold top-level
        cv-qualifiers for a real type node. */
-    fprintf (xdi->file, "  <CvQualifiedType");
-    fprintf (xdi->file, " id=\"_%d%s%s%s\"", id, c, v, r);
+    xml_start_element (xdi, "CvQualifiedType");
+    xml_print_attribute_format (xdi, "id", gccxml_value_id, "_%d%s%s%s",
+                                id, c, v, r);
 
     /* Refer to the unqualified type.  */
-    fprintf (xdi->file, " type=\"_%d\"", id);
+    xml_print_attribute_format (xdi, "type", gccxml_value_idref, "_%d", id);
 
     /* Add the cv-qualification attributes. */
     if (qc)
       {
-      fprintf (xdi->file, " const=\"1\"");
+      xml_print_attribute (xdi, "const", gccxml_value_string, "1");
       }
     if (qv)
       {
-      fprintf (xdi->file, " volatile=\"1\"");
+      xml_print_attribute (xdi, "volatile", gccxml_value_string, "1");
       }
     if (qr)
       {
-      fprintf (xdi->file, " restrict=\"1\"");
+      xml_print_attribute (xdi, "restrict", gccxml_value_string, "1");
       }
-    fprintf (xdi->file, "/>\n");
+    xml_finish_start_tag (xdi, 1);
     }
 }
 
@@ -3023,9 +3905,10 @@ xml_add_overload (xml_dump_info_p xdi, tree o, int complete)
   return 0;
 }
 
-/* Recursively search a type node for template parameters.  */
+/* Recursively search a type node for template parameters.  Callers
+   use xml_find_template_parm, which remembers the answer.  */
 static int
-xml_find_template_parm (tree t)
+xml_find_template_parm_1 (xml_dump_info_p xdi, tree t)
 {
   if(!t)
     {
@@ -3040,7 +3923,7 @@ xml_find_template_parm (tree t)
       int i;
       for(i=0; i < TREE_VEC_LENGTH (t); ++i)
         {
-        if(xml_find_template_parm (TREE_VEC_ELT (t, i)))
+        if(xml_find_template_parm (xdi, TREE_VEC_ELT (t, i)))
           {
           return 1;
           }
@@ -3050,11 +3933,11 @@ xml_find_template_parm (tree t)
     /* A type list has nested types.  */
     case TREE_LIST:
       {
-      if(xml_find_template_parm (TREE_PURPOSE (t)))
+      if(xml_find_template_parm (xdi, TREE_PURPOSE (t)))
         {
         return 1;
         }
-      return xml_find_template_parm (TREE_VALUE (t));
+      return xml_find_template_parm (xdi, TREE_VALUE (t));
       } break;
 
     /* Template parameter types.  */
@@ -3085,13 +3968,13 @@ xml_find_template_parm (tree t)
     case FUNCTION_TYPE:
       {
       tree arg_type = TYPE_ARG_TYPES (t);
-      if(xml_find_template_parm (TREE_TYPE (t)))
+      if(xml_find_template_parm (xdi, TREE_TYPE (t)))
         {
         return 1;
         }
       while (arg_type && (arg_type != void_list_node))
         {
-        if(xml_find_template_parm (arg_type))
+        if(xml_find_template_parm (xdi, arg_type))
           {
           return 1;
           }
@@ -3104,27 +3987,27 @@ xml_find_template_parm (tree t)
       {
       if ((TREE_CODE (t) == RECORD_TYPE) && TYPE_PTRMEMFUNC_P (t))
         {
-        return xml_find_template_parm(TYPE_PTRMEMFUNC_FN_TYPE (t));
+        return xml_find_template_parm (xdi, TYPE_PTRMEMFUNC_FN_TYPE (t));
         }
       if (CLASSTYPE_TEMPLATE_INFO (t))
         {
-        return xml_find_template_parm (CLASSTYPE_TI_ARGS (t));
+        return xml_find_template_parm (xdi, CLASSTYPE_TI_ARGS (t));
         }
       }
-    case REFERENCE_TYPE: return xml_find_template_parm (TREE_TYPE (t));
-    case INDIRECT_REF: return xml_find_template_parm (TREE_TYPE (t));
-    case COMPONENT_REF: return xml_find_template_parm (TREE_TYPE (t));
-    case POINTER_TYPE: return xml_find_template_parm (TREE_TYPE (t));
-    case ARRAY_TYPE: return xml_find_template_parm (TREE_TYPE (t));
+    case REFERENCE_TYPE: return xml_find_template_parm (xdi, TREE_TYPE (t));
+    case INDIRECT_REF: return xml_find_template_parm (xdi, TREE_TYPE (t));
+    case COMPONENT_REF: return xml_find_template_parm (xdi, TREE_TYPE (t));
+    case POINTER_TYPE: return xml_find_template_parm (xdi, TREE_TYPE (t));
+    case ARRAY_TYPE: return xml_find_template_parm (xdi, TREE_TYPE (t));
     case OFFSET_TYPE:
       {
-      return (xml_find_template_parm(TYPE_OFFSET_BASETYPE (t)) ||
-              xml_find_template_parm (TREE_TYPE (t)));
+      return (xml_find_template_parm (xdi, TYPE_OFFSET_BASETYPE (t)) ||
+              xml_find_template_parm (xdi, TREE_TYPE (t)));
       }
     case PTRMEM_CST:
       {
-      return (xml_find_template_parm(PTRMEM_CST_CLASS (t)) ||
-              xml_find_template_parm(PTRMEM_CST_MEMBER(t)));
+      return (xml_find_template_parm (xdi, PTRMEM_CST_CLASS (t)) ||
+              xml_find_template_parm (xdi, PTRMEM_CST_MEMBER(t)));
       }
 
     /* Fundamental types have no nested types.  */
@@ -3153,7 +4036,7 @@ xml_find_template_parm (tree t)
     case PREINCREMENT_EXPR:
     case POSTDECREMENT_EXPR:
     case POSTINCREMENT_EXPR:
-      return xml_find_template_parm (TREE_OPERAND (t, 0));
+      return xml_find_template_parm (xdi, TREE_OPERAND (t, 0));
 
     /* Binary expressions.  */
     case COMPOUND_EXPR:
@@ -3180,31 +4063,31 @@ xml_find_template_parm (tree t)
     case EQ_EXPR:
     case NE_EXPR:
     case EXACT_DIV_EXPR:
-      return (xml_find_template_parm (TREE_OPERAND (t, 0))
-              || xml_find_template_parm (TREE_OPERAND (t, 1)));
+      return (xml_find_template_parm (xdi, TREE_OPERAND (t, 0))
+              || xml_find_template_parm (xdi, TREE_OPERAND (t, 1)));
 
     /* Ternary expressions.  */
     case COND_EXPR:
-      return (xml_find_template_parm (TREE_OPERAND (t, 0))
-              || xml_find_template_parm (TREE_OPERAND (t, 1))
-              || xml_find_template_parm (TREE_OPERAND (t, 2)));
+      return (xml_find_template_parm (xdi, TREE_OPERAND (t, 0))
+              || xml_find_template_parm (xdi, TREE_OPERAND (t, 1))
+              || xml_find_template_parm (xdi, TREE_OPERAND (t, 2)));
 
     /* Other expressions.  */
     case TYPEOF_TYPE:
-      return xml_find_template_parm (TYPEOF_TYPE_EXPR (t));
+      return xml_find_template_parm (xdi, TYPEOF_TYPE_EXPR (t));
     case CALL_EXPR:
       {
       tree arg_expr;
       tree func_expr = TREE_OPERAND (t, 0);
       gcc_assert(func_expr);
-      if (xml_find_template_parm(func_expr))
+      if (xml_find_template_parm (xdi, func_expr))
         {
         return 1;
         }
       arg_expr = TREE_OPERAND (t, 1);
       while (arg_expr)
         {
-        if (xml_find_template_parm(arg_expr))
+        if (xml_find_template_parm (xdi, arg_expr))
           {
           return 1;
           }
@@ -3217,7 +4100,7 @@ xml_find_template_parm (tree t)
       tree argument_vec;
       tree template_expr = TREE_OPERAND (t, 0);
       gcc_assert(template_expr);
-      if (xml_find_template_parm(template_expr))
+      if (xml_find_template_parm (xdi, template_expr))
         {
         return 1;
         }
@@ -3228,7 +4111,7 @@ xml_find_template_parm (tree t)
         for (i = 0; i < TREE_VEC_LENGTH(argument_vec); ++i)
           {
           tree argument_expr = TREE_VEC_ELT(argument_vec, i);
-          if (xml_find_template_parm(argument_expr))
+          if (xml_find_template_parm (xdi, argument_expr))
             {
             return 1;
             }
@@ -3247,6 +4130,93 @@ xml_find_template_parm (tree t)
   return 0;
 }
 
+/* Search T for template parameters.  The instantiations of different
+   templates share most of their argument types, so the answer for each
+   type and argument vector is remembered for the rest of the dump.  */
+static int
+xml_find_template_parm (xml_dump_info_p xdi, tree t)
+{
+  unsigned int serial;
+  int found;
+
+  if (!t || (!TYPE_P (t) && TREE_CODE (t) != TREE_VEC))
+    {
+    return xml_find_template_parm_1 (xdi, t);
+    }
+
+  serial = TREE_SERIAL (t);
+  if (serial < xdi->template_parm_found_size
+      && xdi->template_parm_found[serial])
+    {
+    return xdi->template_parm_found[serial] - 1;
+    }
+
+  found = xml_find_template_parm_1 (xdi, t) ? 1 : 0;
+
+  /* The search may have given serials to other nodes, so make room
+     only now.  */
+  if (serial >= xdi->template_parm_found_size)
+    {
+    unsigned int n = xdi->template_parm_found_size;
+    if (!n)
+      {
+      n = 1024;
+      }
+    while (n <= serial)
+      {
+      n *= 2;
+      }
+    xdi->template_parm_found = XRESIZEVEC (unsigned char,
+                                           xdi->template_parm_found, n);
+    memset (xdi->template_parm_found + xdi->template_parm_found_size, 0,
+            n - xdi->template_parm_found_size);
+    xdi->template_parm_found_size = n;
+    }
+  xdi->template_parm_found[serial] = (unsigned char) (found + 1);
+  return found;
+}
+
+/* Add the real class instantiations of the TEMPLATE_DECL TD.  */
+static void
+xml_add_template_instantiations (xml_dump_info_p xdi, tree td, int complete)
+{
+  tree tl;
+  for (tl = DECL_TEMPLATE_INSTANTIATIONS (td);
+       tl ; tl = TREE_CHAIN (tl))
+    {
+    tree ts = TYPE_NAME (TREE_VALUE (tl));
+    switch (TREE_CODE (ts))
+      {
+      case TYPE_DECL:
+        /* Add the instantiation only if it is real.  */
+        if (!xml_find_template_parm (xdi, TYPE_TI_ARGS(TREE_TYPE(ts))))
+          {
+          xml_add_node (xdi, ts, complete);
+          }
+        break;
+      default:
+        /* xml_output_unimplemented (xdi, ts, 0,
+           "xml_dump_template_decl INSTANTIATIONS");  */
+        break;
+      }
+    }
+}
+
+/* Add the instantiations of the templates already in the dump that
+   were created after their template was added.  Return nonzero if this
+   queued any node.  */
+static int
+xml_add_late_instantiations (xml_dump_info_p xdi)
+{
+  unsigned int i;
+  tree td;
+  for (i = 0; VEC_iterate (tree, xdi->templates, i, td); ++i)
+    {
+    xml_add_template_instantiations (xdi, td, 1);
+    }
+  return xdi->queue != 0;
+}
+
 /* Dump for a TEMPLATE_DECL.  The set of specializations (including
    instantiations) is dumped.  */
 static int
@@ -3274,23 +4244,16 @@ xml_add_template_decl (xml_dump_info_p xdi, tree td, int complete)
     }
 
   /* Dump the template instantiations.  */
-  for (tl = DECL_TEMPLATE_INSTANTIATIONS (td);
-       tl ; tl = TREE_CHAIN (tl))
+  xml_add_template_instantiations (xdi, td, complete);
+
+  /* Remember the template for xml_add_late_instantiations.  */
+  if (complete)
     {
-    tree ts = TYPE_NAME (TREE_VALUE (tl));
-    switch (TREE_CODE (ts))
+    void** slot = htab_find_slot (xdi->template_set, td, INSERT);
+    if (!*slot)
       {
-      case TYPE_DECL:
-        /* Add the instantiation only if it is real.  */
-        if (!xml_find_template_parm (TYPE_TI_ARGS(TREE_TYPE(ts))))
-          {
-          xml_add_node (xdi, ts, complete);
-          }
-        break;
-      default:
-        /* xml_output_unimplemented (xdi, ts, 0,
-           "xml_dump_template_decl INSTANTIATIONS");  */
-        break;
+      *slot = td;
+      VEC_safe_push (tree, heap, xdi->templates, td);
       }
     }
 
@@ -3375,9 +4338,6 @@ xml_dump_tree_node (xml_dump_info_p xdi, tree n, xml_dump_node_p dn)
 # undef xml_add_node
 #endif
 
-/* Hook to suppress diagnostic messages during synthesize test.  */
-extern int diagnostic_xml_synthesize_test;
-
 /* Add tree node N to those encountered.  Return its index.  */
 int
 xml_add_node (xml_dump_info_p xdi, tree n, int complete)
@@ -3403,21 +4363,9 @@ xml_add_node (xml_dump_info_p xdi, tree n, int complete)
 
      when the GCC parser produces the declaration but reports an error
      if the definition is actually needed.  */
-  if (TREE_CODE (n) == FUNCTION_DECL &&
-      DECL_ARTIFICIAL (n) && !DECL_INITIAL (n) &&
-      (!DECL_REALLY_EXTERN (n) || DECL_INLINE (n)))
+  if (TREE_CODE (n) == FUNCTION_DECL && xml_synthesis_needed_p (n))
     {
-    /* We try to synthesize this function but suppress error messages.  */
-    diagnostic_xml_synthesize_test = 1;
-
-    /* Taken from cp_finish_file.  */
-    push_to_top_level ();
-    input_location = DECL_SOURCE_LOCATION (n);
-    synthesize_method (n);
-    pop_from_top_level ();
-
-    /* Error messages have been converted to GCCXML_DECL_ERROR marks.  */
-    diagnostic_xml_synthesize_test = 0;
+    xml_synthesize_test (n);
     }
 
   /* Skip synthesized invalid compiler-generated functions.  */
@@ -3484,9 +4432,12 @@ void xml_dump_files (xml_dump_info_p xdi)
   xml_file_queue_p next_fq;
   for(fq = xdi->file_queue; fq ; fq = next_fq)
     {
-    fprintf (xdi->file, "  <File id=\"f%d\" name=\"%s\"/>\n",
-             (unsigned int) fq->tree_node->value,
-             IDENTIFIER_POINTER ((tree) fq->tree_node->key));
+    xml_start_element (xdi, "File");
+    xml_print_attribute_format (xdi, "id", gccxml_value_id, "f%d",
+                                (unsigned int) fq->tree_node->value);
+    xml_print_attribute (xdi, "name", gccxml_value_string,
+                         IDENTIFIER_POINTER ((tree) fq->tree_node->key));
+    xml_finish_start_tag (xdi, 1);
     next_fq = fq->next;
     free (fq);
     }
@@ -3690,6 +4641,25 @@ xml_get_encoded_identifier_from_string (const char* in_str)
 #undef XML_DOUBLE_QUOTE
 
 /*--------------------------------------------------------------------------*/
+/* Return whether the namespace member T may be dumped.  xml_add_node
+   skips built-in declarations and enumerators without looking further,
+   and the global namespace holds thousands of the former, so they are
+   left out of the all_decls vectors it is given.  */
+static int
+xml_namespace_member_p (tree t)
+{
+  if (TREE_CODE (t) == CONST_DECL)
+    {
+    return 0;
+    }
+  if (TREE_CODE (t) != NAMESPACE_DECL && DECL_P (t)
+      && DECL_SOURCE_LINE (t) == 0)
+    {
+    return 0;
+    }
+  return 1;
+}
+
 /* Called for all identifiers in the symbol table.  */
 static int xml_fill_all_decls(struct cpp_reader* reader, hashnode node,
                               const void* user_data)
@@ -3703,14 +4673,17 @@ static int xml_fill_all_decls(struct cpp_reader* reader, hashnode node,
   (void)user_data;
 
   /* For each binding of this symbol add the declaration to the vector
-     of all declarations in the corresponding scope.  */
+     of all declarations in the corresponding scope.  A binding names
+     one entity once, however often it was redeclared; the type is left
+     out if it is the same declaration as the value.  */
   for(;binding; binding = binding->previous)
     {
-    if(binding->value)
+    if(binding->value && xml_namespace_member_p (binding->value))
       {
       VEC_safe_push (tree, gc, binding->scope->all_decls, binding->value);
       }
-    if(binding->type)
+    if(binding->type && binding->type != binding->value
+       && xml_namespace_member_p (binding->type))
       {
       VEC_safe_push (tree, gc, binding->scope->all_decls, binding->type);
       }
@@ -0,0 +1,90 @@
+/* gccxml_cc1plus - A GCC parser patched for XML dumps of translation units
+   Copyright (C) 2002-2007 Kitware, Inc., Insight Consortium
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the
+
+  Free Software Foundation, Inc.
+  51 Franklin Street, Fifth Floor
+  Boston, MA  02110-1301  USA
+
+*/
+
+/* Loading of the consumer plugin libraries used by xml.c.  This is
+   kept apart from xml.c so the host's dynamic loader headers do not
+   meet the GCC tree headers.  */
+
+#include "config.h"
+#include "system.h"
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+# include <windows.h>
+#elif defined(HAVE_DLFCN_H)
+# include <dlfcn.h>
+#endif
+
+#include "xml_plugin.h"
+
+/* Load the library FILENAME.  Return its handle, or 0 after pointing
+   *MESSAGE at a description of the failure.  */
+void*
+xml_plugin_open (const char* filename, const char** message)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  HMODULE handle = LoadLibraryA (filename);
+  if (!handle)
+    {
+    *message = "LoadLibrary failed";
+    }
+  return (void*) handle;
+#elif defined(HAVE_DLFCN_H)
+  void* handle = dlopen (filename, RTLD_NOW | RTLD_LOCAL);
+  if (!handle)
+    {
+    *message = dlerror ();
+    }
+  return handle;
+#else
+  (void) filename;
+  *message = "plugins are not supported on this host";
+  return 0;
+#endif
+}
+
+/* Look up the function NAME in the library HANDLE.  */
+void*
+xml_plugin_symbol (void* handle, const char* name)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  return (void*) GetProcAddress ((HMODULE) handle, name);
+#elif defined(HAVE_DLFCN_H)
+  return dlsym (handle, name);
+#else
+  (void) handle;
+  (void) name;
+  return 0;
+#endif
+}
+
+/* Unload the library HANDLE.  */
+void
+xml_plugin_close (void* handle)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  FreeLibrary ((HMODULE) handle);
+#elif defined(HAVE_DLFCN_H)
+  dlclose (handle);
+#else
+  (void) handle;
+#endif
+}
@@ -0,0 +1,39 @@
+/* gccxml_cc1plus - A GCC parser patched for XML dumps of translation units
+   Copyright (C) 2002-2007 Kitware, Inc., Insight Consortium
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the
+
+  Free Software Foundation, Inc.
+  51 Franklin Street, Fifth Floor
+  Boston, MA  02110-1301  USA
+
+*/
+
+/* Loading of the consumer plugin libraries, for xml.c.  The
+   definitions are in xml_plugin.c.  */
+
+#ifndef GCCXML_XML_PLUGIN_H
+#define GCCXML_XML_PLUGIN_H
+
+/* Load the library FILENAME.  Return its handle, or 0 after pointing
+   *MESSAGE at a description of the failure.  */
+extern void* xml_plugin_open (const char*, const char**);
+
+/* Look up the function NAME in the library HANDLE.  */
+extern void* xml_plugin_symbol (void*, const char*);
+
+/* Unload the library HANDLE.  */
+extern void xml_plugin_close (void*);
+
+#endif
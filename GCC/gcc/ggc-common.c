@@ -27,6 +27,9 @@ Software Foundation, 51 Franklin Street, Fifth Floor, Boston, MA
 #include "coretypes.h"
 #include "hashtab.h"
 #include "ggc.h"
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#include "input.h"
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 #include "toplev.h"
 #include "params.h"
 #include "hosthooks.h"
@@ -536,12 +539,52 @@ gt_pch_save (FILE *f)
 
 void
 gt_pch_restore (FILE *f)
+{
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (!gt_pch_try_restore (f))
+    fatal_error ("had to relocate PCH");
+}
+
+/* Like gt_pch_restore, but return false instead of failing if the
+   objects cannot be placed at the address they were saved at.  The
+   state of the compiler is unchanged then, so the caller can build it
+   the usual way instead.  */
+
+bool
+gt_pch_try_restore (FILE *f)
 {
   const struct ggc_root_tab *const *rt;
   const struct ggc_root_tab *rti;
   size_t i;
   struct mmap_info mmi;
   int result;
+  long start = ftell (f);
+  size_t skip = 0;
+
+  /* The address follows the variables, so place the objects before
+     overwriting any of those.  */
+  for (rt = gt_pch_scalar_rtab; *rt; rt++)
+    for (rti = *rt; rti->base != NULL; rti++)
+      skip += rti->stride;
+  for (rt = gt_ggc_rtab; *rt; rt++)
+    for (rti = *rt; rti->base != NULL; rti++)
+      skip += rti->nelt * sizeof (void *);
+  for (rt = gt_pch_cache_rtab; *rt; rt++)
+    for (rti = *rt; rti->base != NULL; rti++)
+      skip += rti->nelt * sizeof (void *);
+
+  if (start < 0
+      || fseek (f, start + skip, SEEK_SET) != 0
+      || fread (&mmi, sizeof (mmi), 1, f) != 1)
+    fatal_error ("can't read PCH file: %m");
+
+  result = host_hooks.gt_pch_use_address (mmi.preferred_base, mmi.size,
+                                          fileno (f), mmi.offset);
+  if (result < 0)
+    return false;
+  if (fseek (f, start, SEEK_SET) != 0)
+    fatal_error ("can't read PCH file: %m");
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Delete any deletable objects.  This makes ggc_pch_read much
      faster, as it can be sure that no GCable objects remain other
@@ -571,13 +614,10 @@ gt_pch_restore (FILE *f)
                    sizeof (void *), 1, f) != 1)
           fatal_error ("can't read PCH file: %m");
 
-  if (fread (&mmi, sizeof (mmi), 1, f) != 1)
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (fseek (f, sizeof (mmi), SEEK_CUR) != 0)
     fatal_error ("can't read PCH file: %m");
-
-  result = host_hooks.gt_pch_use_address (mmi.preferred_base, mmi.size,
-                                          fileno (f), mmi.offset);
-  if (result < 0)
-    fatal_error ("had to relocate PCH");
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (result == 0)
     {
       if (fseek (f, mmi.offset, SEEK_SET) != 0
@@ -590,6 +630,9 @@ gt_pch_restore (FILE *f)
   ggc_pch_read (f, mmi.preferred_base);
 
   gt_pch_restore_stringpool ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  return true;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* Default version of HOST_HOOKS_GT_PCH_GET_ADDRESS when mmap is not present.
@@ -764,6 +807,13 @@ ggc_min_heapsize_heuristic (void)
   return phys_kbytes;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The thresholds init_ggc_heuristics chose.  A profile is not used
+   when the user changed them with --param.  */
+static int default_min_expand;
+static int default_min_heapsize;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 void
 init_ggc_heuristics (void)
 {
@@ -771,7 +821,439 @@ init_ggc_heuristics (void)
   set_param_value ("ggc-min-expand", ggc_min_expand_heuristic());
   set_param_value ("ggc-min-heapsize", ggc_min_heapsize_heuristic());
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  default_min_expand = PARAM_VALUE (GGC_MIN_EXPAND);
+  default_min_heapsize = PARAM_VALUE (GGC_MIN_HEAPSIZE);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+}
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* One garbage collection of this run.  */
+struct ggc_collection
+{
+  /* Bytes in use before and after the collection.  */
+  size_t before;
+  size_t after;
+
+  /* Microseconds spent marking, and in the whole collection.  */
+  long mark_usec;
+  long usec;
+
+  /* Whether ggc_force_collect asked for the collection, rather than
+     the thresholds.  */
+  bool forced;
+};
+
+/* The collections of this run, in order.  */
+static struct ggc_collection *ggc_collections;
+static unsigned int ggc_num_collections;
+static unsigned int ggc_max_collections;
+
+/* A collection freeing less than this fraction of the heap was not
+   worth its marking.  */
+#define GGC_LOW_YIELD 0.1
+
+/* The contents of a -fgc-profile file: the thresholds a run used and
+   what its collections achieved.  Sizes are in bytes.  */
+struct ggc_profile
+{
+  /* Number of runs recorded in the file, including this one.  */
+  double runs;
+
+  /* The ggc-min-expand and ggc-min-heapsize values used.  */
+  double min_expand;
+  double min_heapsize;
+
+  /* Number of collections and their totals.  */
+  double collections;
+  double before;
+  double freed;
+  double mark_usec;
+  double usec;
+
+  /* Largest heap left by a collection or at the end of the run.  */
+  double live_peak;
+
+  /* Largest heap at which a collection freed less than GGC_LOW_YIELD
+     of it.  */
+  double low_yield_heap;
+};
+
+/* The profile read by ggc_read_profile.  */
+static struct ggc_profile ggc_last_profile;
+
+static const char ggc_profile_ident[] = "gccxml-gc-profile";
+
+/* Record a collection that found BEFORE bytes in use and left AFTER,
+   spending MARK_USEC microseconds marking and USEC in all.  */
+
+void
+ggc_note_collection (size_t before, size_t after, long mark_usec, long usec)
+{
+  struct ggc_collection *c;
+
+  if (ggc_num_collections == ggc_max_collections)
+    {
+      ggc_max_collections = ggc_max_collections ? 2 * ggc_max_collections : 64;
+      ggc_collections = XRESIZEVEC (struct ggc_collection, ggc_collections,
+                                    ggc_max_collections);
+    }
+  c = &ggc_collections[ggc_num_collections++];
+  c->before = before;
+  c->after = after;
+  c->mark_usec = mark_usec;
+  c->usec = usec;
+  c->forced = ggc_force_collect;
+}
+
+/* Fill in P from the collections of this run so far and the current
+   thresholds.  Forced collections are left out: the thresholds do not
+   decide them.  */
+
+static void
+ggc_summarize_collections (struct ggc_profile *p)
+{
+  unsigned int i;
+
+  memset (p, 0, sizeof (*p));
+  p->runs = ggc_last_profile.runs + 1;
+  p->min_expand = PARAM_VALUE (GGC_MIN_EXPAND);
+  p->min_heapsize = PARAM_VALUE (GGC_MIN_HEAPSIZE);
+  p->live_peak = ggc_heap_size ();
+  for (i = 0; i < ggc_num_collections; i++)
+    {
+      const struct ggc_collection *c = &ggc_collections[i];
+      double freed = c->before > c->after ? c->before - c->after : 0;
+      p->live_peak = MAX (p->live_peak, c->after);
+      if (c->forced)
+        continue;
+      p->collections++;
+      p->before += c->before;
+      p->freed += freed;
+      p->mark_usec += c->mark_usec;
+      p->usec += c->usec;
+      if (freed < c->before * GGC_LOW_YIELD)
+        p->low_yield_heap = MAX (p->low_yield_heap, c->before);
+    }
+}
+
+/* Return the largest heap, in kilobytes, the thresholds chosen from a
+   profile may let grow: the ggc-heap-ceiling parameter, or a quarter
+   of physical memory within the resource limits.  */
+
+double
+ggc_heap_ceiling (void)
+{
+  if (PARAM_VALUE (GGC_HEAP_CEILING))
+    return PARAM_VALUE (GGC_HEAP_CEILING);
+  return ggc_rlimit_bound (physmem_total () / 4) / 1024;
+}
+
+/* Choose ggc-min-expand and ggc-min-heapsize for this run from the
+   collections recorded in the profile FILENAME, unless the user set
+   them.  Collections of earlier runs that freed little are skipped
+   by raising the heap size at which collection starts, and the heap
+   may grow further between collections while they free little of it,
+   as long as the heap stays below ggc_heap_ceiling.  A missing file
+   is the first run of a project and leaves the thresholds alone.  */
+
+void
+ggc_read_profile (const char *filename)
+{
+  struct ggc_profile *p = &ggc_last_profile;
+  FILE *f;
+  char key[64];
+  char ident[sizeof (ggc_profile_ident)];
+  double value, yield, expand, heapsize, base, ceiling;
+  int version;
+
+  if (PARAM_VALUE (GGC_MIN_EXPAND) != default_min_expand
+      || PARAM_VALUE (GGC_MIN_HEAPSIZE) != default_min_heapsize)
+    return;
+
+  f = fopen (filename, "r");
+  if (!f)
+    return;
+  if (fscanf (f, "%17s %d", ident, &version) != 2
+      || strcmp (ident, ggc_profile_ident) != 0 || version != 1)
+    {
+      warning (0, "ignoring garbage collection profile %qs of unknown format",
+               filename);
+      fclose (f);
+      return;
+    }
+  while (fscanf (f, "%63s %lf", key, &value) == 2)
+    {
+      if (strcmp (key, "runs") == 0)
+        p->runs = value;
+      else if (strcmp (key, "min-expand") == 0)
+        p->min_expand = value;
+      else if (strcmp (key, "min-heapsize") == 0)
+        p->min_heapsize = value;
+      else if (strcmp (key, "collections") == 0)
+        p->collections = value;
+      else if (strcmp (key, "heap-before") == 0)
+        p->before = value;
+      else if (strcmp (key, "freed") == 0)
+        p->freed = value;
+      else if (strcmp (key, "mark-usec") == 0)
+        p->mark_usec = value;
+      else if (strcmp (key, "usec") == 0)
+        p->usec = value;
+      else if (strcmp (key, "live-peak") == 0)
+        p->live_peak = value;
+      else if (strcmp (key, "low-yield-heap") == 0)
+        p->low_yield_heap = value;
+    }
+  fclose (f);
+
+  /* Start from the thresholds of the last run and adjust them by the
+     share of the heap its collections freed.  */
+  expand = MAX (p->min_expand, default_min_expand);
+  heapsize = MAX (p->min_heapsize, default_min_heapsize);
+  if (p->collections > 0 && p->before > 0)
+    {
+      yield = p->freed / p->before;
+      if (yield < GGC_LOW_YIELD)
+        expand *= 2;
+      else if (yield < 2 * GGC_LOW_YIELD)
+        expand *= 1.5;
+      else if (yield > 5 * GGC_LOW_YIELD)
+        expand /= 2;
+      heapsize = MAX (heapsize, p->low_yield_heap / 1024);
+    }
+  expand = MIN (MAX (expand, default_min_expand), 1000);
+
+  /* The heap reaches MAX (live data, ggc-min-heapsize) grown by
+     ggc-min-expand percent before the first collection after the
+     peak.  Keep that below the ceiling.  */
+  ceiling = ggc_heap_ceiling ();
+  heapsize = MIN (heapsize, ceiling);
+  base = MAX (heapsize, p->live_peak / 1024);
+  if (base * (100 + expand) / 100 > ceiling)
+    expand = MAX ((ceiling / base - 1) * 100, default_min_expand);
+  if (heapsize * (100 + expand) / 100 > ceiling)
+    heapsize = MAX (ceiling * 100 / (100 + expand), default_min_heapsize);
+
+  set_param_value ("ggc-min-expand", (int) expand);
+  set_param_value ("ggc-min-heapsize", (int) heapsize);
+}
+
+/* Record the thresholds and collections of this run in the profile
+   FILENAME.  The file is replaced as a whole so that concurrent runs
+   on the same project never see half of it.  */
+
+void
+ggc_write_profile (const char *filename)
+{
+  struct ggc_profile p;
+  char *temp;
+  FILE *f;
+
+  ggc_summarize_collections (&p);
+
+  temp = XNEWVEC (char, strlen (filename) + 32);
+  sprintf (temp, "%s.%ld", filename, (long) getpid ());
+  f = fopen (temp, "w");
+  if (!f)
+    {
+      warning (0, "cannot write garbage collection profile %qs: %m", temp);
+      free (temp);
+      return;
+    }
+  fprintf (f, "%s 1\n", ggc_profile_ident);
+  fprintf (f, "runs %.0f\n", p.runs);
+  fprintf (f, "min-expand %.0f\n", p.min_expand);
+  fprintf (f, "min-heapsize %.0f\n", p.min_heapsize);
+  fprintf (f, "collections %.0f\n", p.collections);
+  fprintf (f, "heap-before %.0f\n", p.before);
+  fprintf (f, "freed %.0f\n", p.freed);
+  fprintf (f, "mark-usec %.0f\n", p.mark_usec);
+  fprintf (f, "usec %.0f\n", p.usec);
+  fprintf (f, "live-peak %.0f\n", p.live_peak);
+  fprintf (f, "low-yield-heap %.0f\n", p.low_yield_heap);
+  if (fclose (f) != 0
+      || (rename (temp, filename) != 0
+          && (remove (filename), rename (temp, filename) != 0)))
+    {
+      warning (0, "cannot write garbage collection profile %qs: %m",
+               filename);
+      remove (temp);
+    }
+  free (temp);
+}
+
+/* Print the heap size and yield of each collection of this run, for
+   -fmem-report.  The totals leave out the forced collections, marked
+   with a star.  */
+
+void
+ggc_print_collection_statistics (void)
+{
+  struct ggc_profile p;
+  unsigned int i;
+
+  ggc_summarize_collections (&p);
+  fprintf (stderr, "\nGarbage collections (ggc-min-expand=%d, "
+           "ggc-min-heapsize=%dk):\n",
+           PARAM_VALUE (GGC_MIN_EXPAND), PARAM_VALUE (GGC_MIN_HEAPSIZE));
+  fprintf (stderr, "%5s %12s %12s %7s %10s %10s\n",
+           "#", "Before", "Freed", "Yield", "Mark ms", "Total ms");
+  for (i = 0; i < ggc_num_collections; i++)
+    {
+      const struct ggc_collection *c = &ggc_collections[i];
+      size_t freed = c->before > c->after ? c->before - c->after : 0;
+      fprintf (stderr, "%4u%c %11luk %11luk %6.1f%% %10.1f %10.1f\n", i + 1,
+               c->forced ? '*' : ' ',
+               (unsigned long) (c->before / 1024),
+               (unsigned long) (freed / 1024),
+               c->before ? 100.0 * freed / c->before : 0.0,
+               c->mark_usec / 1000.0, c->usec / 1000.0);
+    }
+  fprintf (stderr, "%5s %11.0fk %11.0fk %6.1f%% %10.1f %10.1f\n", "Total",
+           p.before / 1024, p.freed / 1024,
+           p.before ? 100.0 * p.freed / p.before : 0.0,
+           p.mark_usec / 1000.0, p.usec / 1000.0);
+}
+
+/* Allocations made while the parser was in one source file, for
+   -falloc-report.  */
+struct ggc_file_alloc
+{
+  /* The input_location file pointer, and a copy of its name.  */
+  const char *file;
+  char *name;
+
+  unsigned long count;
+  double bytes;
+};
+
+/* The ggc_file_alloc entries, hashed by file pointer, and the one
+   the last allocation went to.  Allocations come in long runs from
+   the same file, so the hash table is seldom searched.  */
+static htab_t ggc_file_allocs;
+static struct ggc_file_alloc *ggc_last_file_alloc;
+
+static hashval_t
+ggc_file_alloc_hash (const void *p)
+{
+  return htab_hash_pointer (((const struct ggc_file_alloc *) p)->file);
+}
+
+static int
+ggc_file_alloc_eq (const void *p1, const void *p2)
+{
+  return ((const struct ggc_file_alloc *) p1)->file == p2;
+}
+
+/* Charge an allocation of SIZE bytes to the file of input_location.  */
+
+void
+ggc_note_alloc (size_t size)
+{
+  const char *file = input_location.file;
+  struct ggc_file_alloc *f = ggc_last_file_alloc;
+
+  if (!f || f->file != file)
+    {
+      void **slot;
+
+      if (!ggc_file_allocs)
+        ggc_file_allocs = htab_create (64, ggc_file_alloc_hash,
+                                       ggc_file_alloc_eq, NULL);
+      slot = htab_find_slot_with_hash (ggc_file_allocs, file,
+                                       htab_hash_pointer (file), INSERT);
+      f = (struct ggc_file_alloc *) *slot;
+      if (!f)
+        {
+          f = XCNEW (struct ggc_file_alloc);
+          f->file = file;
+          f->name = xstrdup (file ? file : "<none>");
+          *slot = f;
+        }
+      ggc_last_file_alloc = f;
+    }
+  f->count++;
+  f->bytes += size;
+}
+
+/* Append the entry at SLOT to the array cursor DATA.  */
+
+static int
+ggc_collect_file_alloc (void **slot, void *data)
+{
+  struct ggc_file_alloc ***cursor = (struct ggc_file_alloc ***) data;
+  *(*cursor)++ = (struct ggc_file_alloc *) *slot;
+  return 1;
+}
+
+static int
+ggc_file_alloc_name_cmp (const void *p1, const void *p2)
+{
+  const struct ggc_file_alloc *f1 = *(const struct ggc_file_alloc * const *) p1;
+  const struct ggc_file_alloc *f2 = *(const struct ggc_file_alloc * const *) p2;
+  return strcmp (f1->name, f2->name);
+}
+
+static int
+ggc_file_alloc_bytes_cmp (const void *p1, const void *p2)
+{
+  const struct ggc_file_alloc *f1 = *(const struct ggc_file_alloc * const *) p1;
+  const struct ggc_file_alloc *f2 = *(const struct ggc_file_alloc * const *) p2;
+  if (f1->bytes != f2->bytes)
+    return f1->bytes < f2->bytes ? 1 : -1;
+  return strcmp (f1->name, f2->name);
+}
+
+/* Number of files ggc_print_alloc_report lists.  */
+#define GGC_ALLOC_REPORT_ROWS 20
+
+/* Print the files that the most collected memory was allocated in,
+   for -falloc-report.  A file the parser entered more than once may
+   have several entries; they are added up here.  */
+
+void
+ggc_print_alloc_report (void)
+{
+  struct ggc_file_alloc **files, **cursor;
+  unsigned int n, m, i;
+  unsigned long count = 0;
+  double bytes = 0;
+
+  n = ggc_file_allocs ? htab_elements (ggc_file_allocs) : 0;
+  files = XNEWVEC (struct ggc_file_alloc *, n + 1);
+  cursor = files;
+  if (n)
+    htab_traverse_noresize (ggc_file_allocs, ggc_collect_file_alloc, &cursor);
+
+  qsort (files, n, sizeof (*files), ggc_file_alloc_name_cmp);
+  for (i = 0, m = 0; i < n; i++)
+    {
+      count += files[i]->count;
+      bytes += files[i]->bytes;
+      if (m && strcmp (files[m - 1]->name, files[i]->name) == 0)
+        {
+          files[m - 1]->count += files[i]->count;
+          files[m - 1]->bytes += files[i]->bytes;
+          files[i]->count = 0;
+          files[i]->bytes = 0;
+        }
+      else
+        files[m++] = files[i];
+    }
+  qsort (files, m, sizeof (*files), ggc_file_alloc_bytes_cmp);
+
+  fprintf (stderr, "\nCollected memory allocated by source file:\n");
+  fprintf (stderr, "%12s %6s %10s  %s\n", "Bytes", "", "Objects", "File");
+  for (i = 0; i < m && i < GGC_ALLOC_REPORT_ROWS; i++)
+    fprintf (stderr, "%11.0fk %5.1f%% %10lu  %s\n", files[i]->bytes / 1024,
+             bytes ? 100.0 * files[i]->bytes / bytes : 0.0,
+             files[i]->count, files[i]->name);
+  fprintf (stderr, "%11.0fk %6s %10lu  Total (%u files)\n", bytes / 1024, "",
+           count, m);
+  free (files);
 }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifdef GATHER_STATISTICS
 
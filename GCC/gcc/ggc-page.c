@@ -1231,6 +1231,10 @@ ggc_alloc_stat (size_t size MEM_STAT_DECL)
 
   /* For timevar statistics.  */
   timevar_ggc_mem_total += object_size;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (flag_alloc_report)
+    ggc_note_alloc (object_size);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifdef GATHER_STATISTICS
   {
@@ -1881,11 +1885,19 @@ ggc_collect (void)
     MAX (G.allocated_last_gc, (size_t)PARAM_VALUE (GGC_MIN_HEAPSIZE) * 1024);
 
   float min_expand = allocated_last_gc * PARAM_VALUE (GGC_MIN_EXPAND) / 100;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  size_t allocated_before;
+  long start_time, mark_time;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (G.allocated < allocated_last_gc + min_expand && !ggc_force_collect)
     return;
 
   timevar_push (TV_GC);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  allocated_before = G.allocated;
+  start_time = get_run_time ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (!quiet_flag)
     fprintf (stderr, " {GC %luk -> ", (unsigned long) G.allocated / 1024);
   if (GGC_DEBUG_LEVEL >= 2)
@@ -1904,6 +1916,9 @@ ggc_collect (void)
 
   clear_marks ();
   ggc_mark_roots ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  mark_time = get_run_time ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 #ifdef GATHER_STATISTICS
   ggc_prune_overhead_list ();
 #endif
@@ -1912,6 +1927,10 @@ ggc_collect (void)
   sweep_pages ();
 
   G.allocated_last_gc = G.allocated;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  ggc_note_collection (allocated_before, G.allocated, mark_time - start_time,
+                       get_run_time () - start_time);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   timevar_pop (TV_GC);
 
@@ -1921,6 +1940,16 @@ ggc_collect (void)
     fprintf (G.debug_file, "END COLLECTING\n");
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the number of bytes in use in the heap.  */
+
+size_t
+ggc_heap_size (void)
+{
+  return G.allocated;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Print allocation statistics.  */
 #define SCALE(x) ((unsigned long) ((x) < 1024*10 \
                   ? (x) \
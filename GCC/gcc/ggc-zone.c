@@ -1230,6 +1230,10 @@ ggc_alloc_zone_stat (size_t orig_size, struct alloc_zone *zone
   zone->allocated += size;
   
   timevar_ggc_mem_total += size;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (flag_alloc_report)
+    ggc_note_alloc (size);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifdef GATHER_STATISTICS
   ggc_record_overhead (orig_size, size - orig_size, result PASS_MEM_STAT);
@@ -1858,6 +1862,10 @@ ggc_collect (void)
 {
   struct alloc_zone *zone;
   bool marked = false;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  size_t allocated_before;
+  long start_time, elapsed;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   timevar_push (TV_GC);
 
@@ -1883,6 +1891,11 @@ ggc_collect (void)
         }
     }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  allocated_before = ggc_heap_size ();
+  start_time = get_run_time ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Start by possibly collecting the main zone.  */
   main_zone.was_collected = false;
   marked |= ggc_collect_1 (&main_zone, true);
@@ -1947,9 +1960,31 @@ ggc_collect (void)
         }
     }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* Marking is interleaved with the zones' sweeps and not timed
+     apart.  */
+  elapsed = get_run_time () - start_time;
+  ggc_note_collection (allocated_before, ggc_heap_size (), elapsed, elapsed);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   timevar_pop (TV_GC);
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the number of bytes in use in the heap.  */
+
+size_t
+ggc_heap_size (void)
+{
+  struct alloc_zone *zone;
+  size_t allocated = 0;
+
+  for (zone = G.zones; zone; zone = zone->next_zone)
+    allocated += zone->allocated;
+  return allocated;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Print allocation statistics.  */
 #define SCALE(x) ((unsigned long) ((x) < 1024*10 \
                   ? (x) \
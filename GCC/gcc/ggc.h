@@ -242,6 +242,11 @@ extern void dump_ggc_loc_statistics (void);
 #define htab_create_ggc(SIZE, HASH, EQ, DEL) \
   htab_create_alloc (SIZE, HASH, EQ, DEL, ggc_calloc, NULL)
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#define htab_create_ggc_pow2(SIZE, HASH, EQ, DEL) \
+  htab_create_pow2_alloc (SIZE, HASH, EQ, DEL, ggc_calloc, NULL)
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 #define splay_tree_new_ggc(COMPARE)                                         \
   splay_tree_new_with_allocator (COMPARE, NULL, NULL,                         \
                                  &ggc_splay_alloc, &ggc_splay_dont_free, \
@@ -269,6 +274,9 @@ extern void gt_pch_save (FILE *f);
 
 /* Read objects previously saved with gt_pch_save from F.  */
 extern void gt_pch_restore (FILE *f);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern bool gt_pch_try_restore (FILE *f);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Statistics.  */
 
@@ -286,6 +294,29 @@ extern void ggc_print_common_statistics (FILE *, ggc_statistics *);
 
 /* Print allocation statistics.  */
 extern void ggc_print_statistics (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the number of bytes in use in the collected heap.  */
+extern size_t ggc_heap_size (void);
+/* Return the largest heap, in kilobytes, that garbage collection
+   thresholds may let grow.  */
+extern double ggc_heap_ceiling (void);
+
+/* Record a collection, for -fmem-report and -fgc-profile.  */
+extern void ggc_note_collection (size_t, size_t, long, long);
+
+/* Choose the collection thresholds from, and record this run's
+   collections in, a -fgc-profile file.  */
+extern void ggc_read_profile (const char *);
+extern void ggc_write_profile (const char *);
+
+/* Print the collections of this run.  */
+extern void ggc_print_collection_statistics (void);
+
+/* Charge an allocation to the current source file, and print the
+   totals, for -falloc-report.  */
+extern void ggc_note_alloc (size_t);
+extern void ggc_print_alloc_report (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern void stringpool_statistics (void);
 
 /* Heuristics.  */
@@ -226,11 +226,13 @@ void
 gt_pch_save_stringpool (void)
 {
   spd = ggc_alloc (sizeof (*spd));
-  spd->nslots = ident_hash->nslots;
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  spd->nslots = ident_hash->slots->nslots;
   spd->nelements = ident_hash->nelements;
   spd->entries = ggc_alloc (sizeof (spd->entries[0]) * spd->nslots);
-  memcpy (spd->entries, ident_hash->entries,
+  memcpy (spd->entries, ident_hash->slots->entries,
           spd->nslots * sizeof (spd->entries[0]));
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* Return the stringpool to its state before gt_pch_save_stringpool
@@ -27,6 +27,13 @@ Software Foundation, 51 Franklin Street, Fifth Floor, Boston, MA
 #ifdef HAVE_SYS_RESOURCE_H
 #include <sys/resource.h>
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#ifdef HAVE_LINUX_PERF_EVENT_H
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+#endif
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 #include "coretypes.h"
 #include "tm.h"
 #include "intl.h"
@@ -112,6 +119,14 @@ static double clocks_to_msec;
 
 #include "flags.h"
 #include "timevar.h"
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+#include "ggc.h"
+
+/* Count hardware events with perf_event_open where it exists.  */
+#if defined HAVE_LINUX_PERF_EVENT_H && defined __NR_perf_event_open
+# define USE_PERF_EVENTS
+#endif
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 bool timevar_enable;
 
@@ -177,6 +192,46 @@ static struct timevar_stack_def *unused_stack_instances;
    element.  */
 static struct timevar_time_def start_time;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Names of the hardware performance counters, as reported.  */
+static const char *const timevar_counter_names[TIMEVAR_COUNTER_LAST] =
+{
+  "cycles", "instructions", "cache_misses", "branch_misses"
+};
+
+#ifdef USE_PERF_EVENTS
+/* The perf event counted for each timevar_counter_id.  The generic
+   cache miss event counts misses of the last level cache.  */
+static const unsigned int perf_event_configs[TIMEVAR_COUNTER_LAST] =
+{
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES
+};
+
+/* The leader of the group of open counters, or -1 if none is open.
+   The whole group is read with one system call.  */
+static int perf_group_fd = -1;
+
+/* The position of each counter in a read of the group, or -1 if the
+   counter could not be opened.  */
+static int perf_slots[TIMEVAR_COUNTER_LAST];
+
+/* The number of counters in the group.  */
+static int perf_num_slots;
+#endif
+
+/* Why no hardware counter is available, or NULL if some are.  They
+   are only opened for -ftime-report and -ftime-report-file.  */
+static const char *timevar_counters_missing;
+
+static void timevar_open_counters (void);
+static void get_counters (struct timevar_time_def *);
+static void timevar_print_file_line (FILE *, const char *,
+                                     const struct timevar_time_def *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 static void get_time (struct timevar_time_def *);
 static void timevar_accumulate (struct timevar_time_def *,
                                 struct timevar_time_def *,
@@ -193,10 +248,37 @@ get_time (struct timevar_time_def *now)
   now->sys  = 0;
   now->wall = 0;
   now->ggc_mem = timevar_ggc_mem_total;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  now->max_rss = 0;
+  now->ggc_heap = 0;
+  memset (now->counters, 0, sizeof (now->counters));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (!timevar_enable)
     return;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  now->ggc_heap = ggc_heap_size ();
+  get_counters (now);
+
+#if defined HAVE_GETRUSAGE && defined HAVE_GETTIMEOFDAY
+  /* getrusage gives the peak resident set as well as the times, so
+     take the wall time from gettimeofday, which usually needs no
+     system call, instead of making a second system call.  */
+  {
+    struct rusage rusage;
+    struct timeval tv;
+    getrusage (RUSAGE_SELF, &rusage);
+    gettimeofday (&tv, NULL);
+    now->wall = tv.tv_sec + tv.tv_usec * 1e-6;
+    now->user = rusage.ru_utime.tv_sec + rusage.ru_utime.tv_usec * 1e-6;
+    now->sys  = rusage.ru_stime.tv_sec + rusage.ru_stime.tv_usec * 1e-6;
+    now->max_rss = rusage.ru_maxrss;
+    return;
+  }
+#endif
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   {
 #ifdef USE_TIMES
     struct tms tms;
@@ -227,8 +309,96 @@ timevar_accumulate (struct timevar_time_def *timer,
   timer->sys += stop_time->sys - start_time->sys;
   timer->wall += stop_time->wall - start_time->wall;
   timer->ggc_mem += stop_time->ggc_mem - start_time->ggc_mem;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  {
+    int i;
+
+    timer->max_rss += stop_time->max_rss - start_time->max_rss;
+    if (timer->ggc_heap < start_time->ggc_heap)
+      timer->ggc_heap = start_time->ggc_heap;
+    if (timer->ggc_heap < stop_time->ggc_heap)
+      timer->ggc_heap = stop_time->ggc_heap;
+    for (i = 0; i < TIMEVAR_COUNTER_LAST; i++)
+      timer->counters[i] += stop_time->counters[i] - start_time->counters[i];
+  }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Start the hardware performance counters for -ftime-report.  If
+   none can be started, record why in timevar_counters_missing.  */
+
+static void
+timevar_open_counters (void)
+{
+#ifdef USE_PERF_EVENTS
+  struct perf_event_attr attr;
+  int error = 0;
+  int i;
+
+  for (i = 0; i < TIMEVAR_COUNTER_LAST; i++)
+    {
+      int fd;
+
+      memset (&attr, 0, sizeof (attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof (attr);
+      attr.config = perf_event_configs[i];
+      attr.read_format = (PERF_FORMAT_GROUP
+                          | PERF_FORMAT_TOTAL_TIME_ENABLED
+                          | PERF_FORMAT_TOTAL_TIME_RUNNING);
+      attr.disabled = perf_group_fd < 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      perf_slots[i] = -1;
+      fd = syscall (__NR_perf_event_open, &attr, 0, -1, perf_group_fd, 0);
+      if (fd < 0)
+        {
+          error = errno;
+          continue;
+        }
+      if (perf_group_fd < 0)
+        perf_group_fd = fd;
+      perf_slots[i] = perf_num_slots++;
+    }
+
+  if (perf_group_fd < 0)
+    timevar_counters_missing = xstrerror (error);
+  else
+    ioctl (perf_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+  timevar_counters_missing = "not supported on this host";
+#endif
+}
+
+/* Fill the current hardware counter values into NOW.  */
+
+static void
+get_counters (struct timevar_time_def *now ATTRIBUTE_UNUSED)
+{
+#ifdef USE_PERF_EVENTS
+  /* The number of counters, the times the group was enabled and
+     running, and then the counter values.  */
+  unsigned long long values[3 + TIMEVAR_COUNTER_LAST];
+  double scale;
+  int i;
+
+  if (perf_group_fd < 0
+      || read (perf_group_fd, values, sizeof (values))
+         < (ssize_t) ((3 + perf_num_slots) * sizeof (values[0])))
+    return;
+
+  /* Scale up for the time the kernel had the counters switched out
+     to share the hardware.  */
+  scale = values[2] ? (double) values[1] / values[2] : 0;
+  for (i = 0; i < TIMEVAR_COUNTER_LAST; i++)
+    if (perf_slots[i] >= 0)
+      now->counters[i] = values[3 + perf_slots[i]] * scale;
+#endif
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Initialize timing variables.  */
 
 void
@@ -251,6 +421,13 @@ timevar_init (void)
 #ifdef USE_CLOCK
   clocks_to_msec = CLOCKS_TO_MSEC;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+
+  if (time_report || time_report_file)
+    timevar_open_counters ();
+  else
+    timevar_counters_missing = "not requested";
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* Push TIMEVAR onto the timing stack.  No further elapsed time is
@@ -479,6 +656,46 @@ timevar_print (FILE *fp)
 #endif
   fprintf (fp, "%8u kB\n", (unsigned) (total->ggc_mem >> 10));
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* The memory each phase took and the hardware events counted in
+     it.  */
+  fputs (_("\nMemory and hardware counters (rss: growth of the peak "
+           "resident set,\nheap: largest collected heap seen)\n"), fp);
+  for (id = 0; id < (unsigned int) TIMEVAR_LAST; ++id)
+    {
+      struct timevar_def *tv = &timevars[(timevar_id_t) id];
+      const double tiny = 5e-3;
+      const double *counters = tv->elapsed.counters;
+
+      if (!tv->used || (timevar_id_t) id == TV_TOTAL)
+        continue;
+      if (tv->elapsed.user < tiny
+          && tv->elapsed.sys < tiny
+          && tv->elapsed.wall < tiny
+          && tv->elapsed.ggc_mem < GGC_MEM_BOUND)
+        continue;
+
+      fprintf (fp, " %-22s:%8lu kB rss%8lu kB heap", tv->name,
+               (unsigned long) tv->elapsed.max_rss,
+               (unsigned long) (tv->elapsed.ggc_heap >> 10));
+      if (!timevar_counters_missing)
+        fprintf (fp, "%8.3fG cyc%5.2f ipc%8.3fM llc%8.3fM br",
+                 counters[TIMEVAR_CYCLES] * 1e-9,
+                 (counters[TIMEVAR_CYCLES] == 0 ? 0
+                  : counters[TIMEVAR_INSTRUCTIONS]
+                    / counters[TIMEVAR_CYCLES]),
+                 counters[TIMEVAR_CACHE_MISSES] * 1e-6,
+                 counters[TIMEVAR_BRANCH_MISSES] * 1e-6);
+      putc ('\n', fp);
+    }
+  fprintf (fp, _(" TOTAL                 :%8lu kB rss\n"),
+           (unsigned long) total->max_rss);
+  if (timevar_counters_missing && (time_report || time_report_file))
+    fprintf (fp, _("Hardware counters unavailable: %s\n"),
+             timevar_counters_missing);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
+
 #ifdef ENABLE_CHECKING
   fprintf (fp, "Extra diagnostic checks enabled; compiler may run slowly.\n");
   fprintf (fp, "Configure with --disable-checking to disable checks.\n");
@@ -488,6 +705,75 @@ timevar_print (FILE *fp)
           || defined (HAVE_WALL_TIME) */
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Write the line of the -ftime-report-file table for the timing
+   variable NAME, which measured ELAPSED, to FP.  */
+
+static void
+timevar_print_file_line (FILE *fp, const char *name,
+                         const struct timevar_time_def *elapsed)
+{
+  int i;
+
+  fprintf (fp, "%s\t%.3f\t%.3f\t%.3f\t%lu\t%lu\t%lu", name,
+           elapsed->user, elapsed->sys, elapsed->wall,
+           (unsigned long) (elapsed->ggc_mem >> 10),
+           (unsigned long) elapsed->max_rss,
+           (unsigned long) (elapsed->ggc_heap >> 10));
+  for (i = 0; i < TIMEVAR_COUNTER_LAST; i++)
+    if (timevar_counters_missing)
+      fputs ("\t-", fp);
+    else
+      fprintf (fp, "\t%.0f", elapsed->counters[i]);
+  putc ('\n', fp);
+}
+
+/* Write every used timing variable to the file FILENAME for
+   -ftime-report-file, one line each with tab-separated fields named by
+   a first line starting with "#".  Times are in seconds and memory in
+   kB.  A hardware counter that is not available is written as "-".  */
+
+void
+timevar_print_file (const char *filename)
+{
+  unsigned int /* timevar_id_t */ id;
+  struct timevar_time_def total = timevars[TV_TOTAL].elapsed;
+  FILE *fp;
+  int i;
+
+  if (!timevar_enable)
+    return;
+
+  fp = fopen (filename, "w");
+  if (!fp)
+    {
+      error ("could not open time report file %s: %m", filename);
+      return;
+    }
+
+  fputs ("# timevar\tuser\tsys\twall\tggc_kb\trss_kb\theap_kb", fp);
+  for (i = 0; i < TIMEVAR_COUNTER_LAST; i++)
+    fprintf (fp, "\t%s", timevar_counter_names[i]);
+  putc ('\n', fp);
+
+  for (id = 0; id < (unsigned int) TIMEVAR_LAST; ++id)
+    {
+      struct timevar_def *tv = &timevars[(timevar_id_t) id];
+
+      /* The total goes last, as in timevar_print.  */
+      if ((timevar_id_t) id == TV_TOTAL || !tv->used)
+        continue;
+      timevar_print_file_line (fp, tv->name, &tv->elapsed);
+      if (total.ggc_heap < tv->elapsed.ggc_heap)
+        total.ggc_heap = tv->elapsed.ggc_heap;
+    }
+  timevar_print_file_line (fp, "TOTAL", &total);
+
+  if (fclose (fp))
+    error ("writing time report file %s: %m", filename);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Prints a message to stderr stating that time elapsed in STR is
    TOTAL (given in microseconds).  */
 
@@ -44,6 +44,22 @@
        variable.
 */
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Hardware performance counters sampled with the timing variables
+   when -ftime-report is given and the host supports them.  */
+
+typedef enum
+{
+  TIMEVAR_CYCLES,
+  TIMEVAR_INSTRUCTIONS,
+  TIMEVAR_CACHE_MISSES,
+  TIMEVAR_BRANCH_MISSES,
+  TIMEVAR_COUNTER_LAST
+}
+timevar_counter_id;
+
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* This structure stores the various varieties of time that can be
    measured.  Times are stored in seconds.  The time may be an
    absolute time or a time difference; in the former case, the time
@@ -64,6 +80,20 @@ struct timevar_time_def
 
   /* Garbage collector memory.  */
   unsigned ggc_mem;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+
+  /* Peak resident set size of the process, in kB.  */
+  size_t max_rss;
+
+  /* Bytes in use in the garbage collected heap.  For an elapsed time
+     this is the largest size seen when the variable was pushed,
+     popped or exposed.  */
+  size_t ggc_heap;
+
+  /* Values of the hardware performance counters, indexed by
+     timevar_counter_id.  Zero where a counter is not available.  */
+  double counters[TIMEVAR_COUNTER_LAST];
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 };
 
 /* An enumeration of timing variable identifiers.  Constructed from
@@ -90,6 +120,9 @@ extern void timevar_pop_1 (timevar_id_t);
 extern void timevar_start (timevar_id_t);
 extern void timevar_stop (timevar_id_t);
 extern void timevar_print (FILE *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void timevar_print_file (const char *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Provided for backward compatibility.  */
 extern void print_time (const char *, long);
@@ -132,7 +132,9 @@ static bool no_backend;
 const char *progname;
 
 /* Copy of argument vector to toplev_main.  */
-static const char **save_argv;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+const char **save_argv;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Name of top-level original source file (what was input to cpp).
    This comes from the #-command at the beginning of the actual input.
@@ -1970,6 +1972,9 @@ finalize (void)
   if (mem_report)
     {
       ggc_print_statistics ();
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      ggc_print_collection_statistics ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
       stringpool_statistics ();
       dump_tree_statistics ();
       dump_rtx_statistics ();
@@ -1977,6 +1982,13 @@ finalize (void)
       dump_alloc_pool_statistics ();
       dump_ggc_loc_statistics ();
     }
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (flag_alloc_report)
+    {
+      ggc_print_alloc_report ();
+      print_tree_alloc_report ();
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Free up memory for the benefit of leak detectors.  */
   free_reg_info ();
@@ -1991,10 +2003,20 @@ do_compile (void)
 {
   /* Initialize timing first.  The C front ends read the main file in
      the post_options hook, and C++ does file timings.  */
-  if (time_report || !quiet_flag  || flag_detailed_statistics)
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (time_report || time_report_file || !quiet_flag
+      || flag_detailed_statistics)
     timevar_init ();
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   timevar_start (TV_TOTAL);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* Choose the collection thresholds before the front end allocates
+     much.  */
+  if (gc_profile_file)
+    ggc_read_profile (gc_profile_file);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   process_options ();
 
   /* Don't do any more if an error has already occurred.  */
@@ -2016,9 +2038,21 @@ do_compile (void)
       finalize ();
     }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* A run stopped by errors does not show the usual collections.  */
+  if (gc_profile_file && !errorcount)
+    ggc_write_profile (gc_profile_file);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Stop timing and print the times.  */
   timevar_stop (TV_TOTAL);
-  timevar_print (stderr);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* -ftime-report-file alone does not print to the terminal.  */
+  if (time_report || !quiet_flag || flag_detailed_statistics)
+    timevar_print (stderr);
+  if (time_report_file)
+    timevar_print_file (time_report_file);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* Entry point of cc1, cc1plus, jc1, f771, etc.
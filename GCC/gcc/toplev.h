@@ -104,6 +104,9 @@ extern void write_global_declarations (void);
 extern unsigned local_tick;
 
 extern const char *progname;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern const char **save_argv;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern const char *dump_base_name;
 extern const char *aux_base_name;
 extern const char *aux_info_file_name;
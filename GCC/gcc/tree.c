@@ -102,10 +102,33 @@ static const char * const tree_node_kind_names[] = {
 };
 #endif /* GATHER_STATISTICS */
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Number and bytes of the nodes made of each code, for
+   -falloc-report.  Unlike the GATHER_STATISTICS counts these are
+   always compiled in, and kept only when the option is given.  */
+static unsigned long tree_code_alloc_counts[MAX_TREE_CODES];
+static double tree_code_alloc_bytes[MAX_TREE_CODES];
+
+#define NOTE_TREE_ALLOC(CODE, LENGTH)                            \
+  do                                                             \
+    {                                                            \
+      if (flag_alloc_report)                                     \
+        {                                                        \
+          tree_code_alloc_counts[(int) (CODE)]++;                \
+          tree_code_alloc_bytes[(int) (CODE)] += (LENGTH);       \
+        }                                                        \
+    }                                                            \
+  while (0)
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Unique id for next decl created.  */
 static GTY(()) int next_decl_uid;
 /* Unique id for next type created.  */
 static GTY(()) int next_type_uid = 1;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Serial number of the next node given one by TREE_SERIAL.  */
+static GTY(()) unsigned int next_tree_serial = 1;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Since we cannot rehash a type after it is in the table, we have to
    keep the hash code.  */
@@ -217,8 +240,10 @@ void
 init_ttree (void)
 {
   /* Initialize the hash table of types.  */
-  type_hash_table = htab_create_ggc (TYPE_HASH_INITIAL_SIZE, type_hash_hash,
-                                     type_hash_eq, 0);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  type_hash_table = htab_create_ggc_pow2 (TYPE_HASH_INITIAL_SIZE,
+                                          type_hash_hash, type_hash_eq, 0);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   debug_expr_for_decl = htab_create_ggc (512, tree_map_hash,
                                          tree_map_eq, 0);
@@ -230,8 +255,10 @@ init_ttree (void)
   restrict_base_for_decl = htab_create_ggc (256, tree_map_hash,
                                             tree_map_eq, 0);
 
-  int_cst_hash_table = htab_create_ggc (1024, int_cst_hash_hash,
-                                        int_cst_hash_eq, NULL);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  int_cst_hash_table = htab_create_ggc_pow2 (1024, int_cst_hash_hash,
+                                             int_cst_hash_eq, NULL);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   
   int_cst_node = make_node (INTEGER_CST);
 
@@ -520,6 +547,9 @@ make_node_stat (enum tree_code code MEM_STAT_DECL)
   tree_node_counts[(int) kind]++;
   tree_node_sizes[(int) kind] += length;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (code, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (code == IDENTIFIER_NODE)
     t = ggc_alloc_zone_pass_stat (length, &tree_id_zone);
@@ -612,6 +642,9 @@ copy_node_stat (tree node MEM_STAT_DECL)
   gcc_assert (code != STATEMENT_LIST);
 
   length = tree_size (node);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (code, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   t = ggc_alloc_zone_pass_stat (length, &tree_zone);
   memcpy (t, node, length);
 
@@ -619,6 +652,9 @@ copy_node_stat (tree node MEM_STAT_DECL)
   TREE_ASM_WRITTEN (t) = 0;
   TREE_VISITED (t) = 0;
   t->common.ann = 0;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  t->common.serial = 0;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   if (TREE_CODE_CLASS (code) == tcc_declaration)
     {
@@ -662,6 +698,19 @@ copy_node_stat (tree node MEM_STAT_DECL)
   return t;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Give NODE the next serial number and return it.  Used by
+   TREE_SERIAL.  */
+
+unsigned int
+assign_tree_serial (tree node)
+{
+  gcc_assert (!node->common.serial && next_tree_serial);
+  node->common.serial = next_tree_serial++;
+  return node->common.serial;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Return a copy of a chain of nodes, chained through the TREE_CHAIN field.
    For example, this can copy a list made of TREE_LIST nodes.  */
 
@@ -1131,6 +1180,9 @@ build_string (int len, const char *str)
   tree_node_counts[(int) c_kind]++;
   tree_node_sizes[(int) c_kind] += length;
 #endif  
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (STRING_CST, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   s = ggc_alloc_tree (length);
 
@@ -1218,6 +1270,9 @@ make_tree_binfo_stat (unsigned base_binfos MEM_STAT_DECL)
   tree_node_counts[(int) binfo_kind]++;
   tree_node_sizes[(int) binfo_kind] += length;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (TREE_BINFO, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   t = ggc_alloc_zone_pass_stat (length, &tree_zone);
 
@@ -1243,6 +1298,9 @@ make_tree_vec_stat (int len MEM_STAT_DECL)
   tree_node_counts[(int) vec_kind]++;
   tree_node_sizes[(int) vec_kind] += length;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (TREE_VEC, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   t = ggc_alloc_zone_pass_stat (length, &tree_zone);
 
@@ -1718,6 +1776,9 @@ tree_cons_stat (tree purpose, tree value, tree chain MEM_STAT_DECL)
   tree_node_counts[(int) x_kind]++;
   tree_node_sizes[(int) x_kind] += sizeof (struct tree_list);
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (TREE_LIST, sizeof (struct tree_list));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   TREE_SET_CODE (node, TREE_LIST);
   TREE_CHAIN (node) = chain;
@@ -2877,6 +2938,9 @@ build1_stat (enum tree_code code, tree type, tree node MEM_STAT_DECL)
   tree_node_counts[(int) kind]++;
   tree_node_sizes[(int) kind] += length;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (code, length);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   gcc_assert (TREE_CODE_LENGTH (code) == 1);
 
@@ -5999,6 +6063,55 @@ dump_tree_statistics (void)
   print_restrict_base_statistics ();
   lang_hooks.print_statistics ();
 }
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+
+/* Compare the codes at P1 and P2 by the bytes of their nodes.  */
+
+static int
+tree_alloc_code_cmp (const void *p1, const void *p2)
+{
+  int c1 = *(const int *) p1;
+  int c2 = *(const int *) p2;
+
+  if (tree_code_alloc_bytes[c1] != tree_code_alloc_bytes[c2])
+    return tree_code_alloc_bytes[c1] < tree_code_alloc_bytes[c2] ? 1 : -1;
+  return c1 - c2;
+}
+
+/* Number of codes print_tree_alloc_report lists.  */
+#define TREE_ALLOC_REPORT_ROWS 20
+
+/* Print the tree codes whose nodes took the most memory, for
+   -falloc-report.  */
+
+void
+print_tree_alloc_report (void)
+{
+  int codes[MAX_TREE_CODES];
+  int i, n = 0;
+  unsigned long count = 0;
+  double bytes = 0;
+
+  for (i = 0; i < MAX_TREE_CODES; i++)
+    if (tree_code_alloc_counts[i])
+      {
+        codes[n++] = i;
+        count += tree_code_alloc_counts[i];
+        bytes += tree_code_alloc_bytes[i];
+      }
+  qsort (codes, n, sizeof (int), tree_alloc_code_cmp);
+
+  fprintf (stderr, "\nTree nodes allocated by code:\n");
+  fprintf (stderr, "%12s %6s %10s  %s\n", "Bytes", "", "Nodes", "Code");
+  for (i = 0; i < n && i < TREE_ALLOC_REPORT_ROWS; i++)
+    fprintf (stderr, "%11.0fk %5.1f%% %10lu  %s\n",
+             tree_code_alloc_bytes[codes[i]] / 1024,
+             bytes ? 100.0 * tree_code_alloc_bytes[codes[i]] / bytes : 0.0,
+             tree_code_alloc_counts[codes[i]], tree_code_name[codes[i]]);
+  fprintf (stderr, "%11.0fk %6s %10lu  Total\n", bytes / 1024, "", count);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #define FILE_FUNCTION_FORMAT "_GLOBAL__%s_%s"
 
@@ -6992,6 +7105,9 @@ build_omp_clause (enum omp_clause_code code)
   tree_node_counts[(int) omp_clause_kind]++;
   tree_node_sizes[(int) omp_clause_kind] += size;
 #endif
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  NOTE_TREE_ALLOC (OMP_CLAUSE, size);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   
   return t;
 }
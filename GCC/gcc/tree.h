@@ -381,6 +381,12 @@ struct tree_common GTY(())
   unsigned lang_flag_5 : 1;
   unsigned lang_flag_6 : 1;
   unsigned visited : 1;
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* See TREE_SERIAL.  This fills the padding after the flags on
+     LP64 hosts.  */
+  unsigned int serial;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 };
 
 /* The following table lists the uses of each of the above flags and
@@ -558,6 +564,15 @@ enum tree_node_structure_enum {
 #define TREE_CODE(NODE) ((enum tree_code) (NODE)->common.code)
 #define TREE_SET_CODE(NODE, VALUE) ((NODE)->common.code = (VALUE))
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* A dense serial number for NODE, assigned the first time it is asked
+   for and never 0.  Nodes are numbered 1, 2, ... in the order they are
+   first asked about, so per-node data can be kept in flat arrays
+   indexed by serial.  A copy of a node gets a serial of its own.  */
+#define TREE_SERIAL(NODE) \
+  ((NODE)->common.serial ? (NODE)->common.serial : assign_tree_serial (NODE))
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* When checking is enabled, errors will be generated if a tree node
    is accessed incorrectly. The macros die with a fatal error.  */
 #if defined ENABLE_TREE_CHECKING && (GCC_VERSION >= 2007)
@@ -3475,6 +3490,9 @@ extern tree make_node_stat (enum tree_code MEM_STAT_DECL);
 /* Make a copy of a node, with all the same contents.  */
 
 extern tree copy_node_stat (tree MEM_STAT_DECL);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern unsigned int assign_tree_serial (tree);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 #define copy_node(t) copy_node_stat (t MEM_STAT_INFO)
 
 /* Make a copy of a chain of TREE_LIST nodes.  */
@@ -4350,6 +4368,9 @@ extern tree type_hash_lookup (unsigned int, tree);
 extern void type_hash_add (unsigned int, tree);
 extern int simple_cst_list_equal (tree, tree);
 extern void dump_tree_statistics (void);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void print_tree_alloc_report (void);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern void expand_function_end (void);
 extern void expand_function_start (tree);
 extern void stack_protect_prologue (void);
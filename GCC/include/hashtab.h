@@ -139,6 +139,18 @@ struct htab GTY(())
   /* Current size (in entries) of the hash table, as an index into the
      table of primes.  */
   unsigned int size_prime_index;
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* For a table created by htab_create_pow2_alloc, log2 of the current
+     size.  Such tables are sized by powers of two and probed linearly.
+     Zero for tables sized by primes.  */
+  unsigned int size_log2;
+
+  /* Nonzero if a power-of-two table hashes and compares its entries
+     with htab_hash_pointer and htab_eq_pointer.  The probe loops then
+     compare the pointers directly instead of calling through eq_f.  */
+  unsigned int pointer_keys;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 };
 
 typedef struct htab *htab_t;
@@ -157,10 +169,22 @@ extern htab_t        htab_create_alloc_ex (size_t, htab_hash,
                                       void *, htab_alloc_with_arg,
                                       htab_free_with_arg);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern htab_t        htab_create_pow2_alloc (size_t, htab_hash,
+                                        htab_eq, htab_del,
+                                        htab_alloc, htab_free);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Backward-compatibility functions.  */
 extern htab_t htab_create (size_t, htab_hash, htab_eq, htab_del);
 extern htab_t htab_try_create (size_t, htab_hash, htab_eq, htab_del);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Power-of-two variant of htab_create.  */
+#define htab_create_pow2(SIZE, HASH, EQ, DEL) \
+  htab_create_pow2_alloc (SIZE, HASH, EQ, DEL, xcalloc, free)
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 extern void        htab_set_functions_ex (htab_t, htab_hash,
                                        htab_eq, htab_del,
                                        void *, htab_alloc_with_arg,
@@ -1253,6 +1253,21 @@ _cpp_restore_pragma_names (cpp_reader *pfile, char **saved)
   free (saved);
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Free the names saved by _cpp_save_pragma_names without restoring
+   them.  */
+
+void
+_cpp_free_pragma_names (cpp_reader *pfile, char **saved)
+{
+  int i, ct = count_registered_pragmas (pfile->pragmas);
+
+  for (i = 0; i < ct; i++)
+    free (saved[i]);
+  free (saved);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Pragmata handling.  We handle some, and pass the rest on to the
    front end.  C99 defines three pragmas and says that no macro
    expansion is to be performed on them; whether or not macro
@@ -111,6 +111,11 @@ struct _cpp_file
 
   /* File is a PCH (on return from find_include_file).  */
   bool pch;
+
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* The contents given by cpp_add_virtual_file for PATH, if any.  */
+  const struct virtual_file *virt;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 };
 
 /* A singly-linked list for all searches for a given file name, with
@@ -151,6 +156,43 @@ struct file_hash_entry
   } u;
 };
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The names in a directory, read once for -fcache-include-dirs.
+   Directories are entered in PFILE->dir_listing_hash by path, as
+   passed to opendir, when a header is first looked for in them;
+   subdirectories only when a header name leads into them.  */
+struct dir_listing
+{
+  const char *path;
+
+  /* The names in the directory, or NULL if it could not be read, in
+     which case nothing is known about it.  A directory that does not
+     exist has an empty table.  */
+  htab_t names;
+};
+
+/* The contents of a file given by cpp_add_virtual_file, or one of
+   the directories leading to it.  These are entered in
+   PFILE->virtual_file_hash by their path as virtual_path spells it.  */
+struct virtual_file
+{
+  const char *path;
+  const uchar *buffer;
+  size_t len;
+
+  /* Whether this is a directory.  A directory exists if a file has
+     been given in it, even when the file system has no such path.  */
+  bool dir;
+
+  /* The identity the file or directory has in its stat.  Virtual
+     entries are on a device of their own, VIRTUAL_FILE_DEV, and are
+     numbered from 1 in the order they were first given.  */
+  ino_t ino;
+};
+
+#define VIRTUAL_FILE_DEV ((dev_t) -1)
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 static bool open_file (_cpp_file *file);
 static bool pch_open_file (cpp_reader *pfile, _cpp_file *file,
                            bool *invalid_pch);
@@ -181,6 +223,25 @@ static bool validate_pch (cpp_reader *, _cpp_file *file, const char *pchname);
 static int pchf_save_compare (const void *e1, const void *e2);
 static int pchf_compare (const void *d_p, const void *e_p);
 static bool check_file_against_entries (cpp_reader *, _cpp_file *, bool);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static struct dir_listing *read_dir_listing (cpp_reader *, const char *);
+static bool listing_may_contain (cpp_reader *, cpp_dir *, const char *);
+static bool file_known_missing (cpp_reader *, _cpp_file *);
+static hashval_t dir_listing_hash (const void *);
+static int dir_listing_eq (const void *, const void *);
+static void dir_listing_free (void *);
+static int name_eq (const void *, const void *);
+static char *virtual_path (const char *);
+static const struct virtual_file *find_virtual_file (cpp_reader *,
+                                                     const char *);
+static void stat_virtual_file (const struct virtual_file *, struct stat *);
+static struct virtual_file *enter_virtual_file (cpp_reader *, char *);
+static bool open_virtual_file (cpp_reader *, _cpp_file *);
+static bool read_virtual_file (cpp_reader *, _cpp_file *);
+static hashval_t virtual_file_hash (const void *);
+static int virtual_file_eq (const void *, const void *);
+static void virtual_file_free (void *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Given a filename in FILE->PATH, with the empty string interpreted
    as <stdin>, open it.
@@ -327,6 +388,19 @@ find_file_in_dir (cpp_reader *pfile, _cpp_file *file, bool *invalid_pch)
   if (path)
     {
       file->path = path;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      if (open_virtual_file (pfile, file))
+        return true;
+
+      if (file_known_missing (pfile, file))
+        {
+          free (path);
+          file->err_no = ENOENT;
+          file->path = file->name;
+          return false;
+        }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
       if (pch_open_file (pfile, file, invalid_pch))
         return true;
 
@@ -351,6 +425,436 @@ find_file_in_dir (cpp_reader *pfile, _cpp_file *file, bool *invalid_pch)
   return false;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the listing of the directory PATH, reading it if this is the
+   first time it is needed.  */
+static struct dir_listing *
+read_dir_listing (cpp_reader *pfile, const char *path)
+{
+  struct dir_listing *listing;
+  void **slot;
+  DIR *dir;
+
+  slot = htab_find_slot_with_hash (pfile->dir_listing_hash, path,
+                                   htab_hash_string (path), INSERT);
+  if (*slot)
+    return (struct dir_listing *) *slot;
+
+  listing = XNEW (struct dir_listing);
+  listing->path = xstrdup (path);
+  listing->names = NULL;
+  dir = opendir (*path ? path : ".");
+  if (dir)
+    {
+      struct dirent *d;
+
+      listing->names = htab_create_pow2 (32, htab_hash_string, name_eq,
+                                         free);
+      while ((d = readdir (dir)) != NULL)
+        {
+          void **name_slot = htab_find_slot (listing->names, d->d_name,
+                                             INSERT);
+          if (!*name_slot)
+            *name_slot = xstrdup (d->d_name);
+        }
+      closedir (dir);
+    }
+  else if (errno == ENOENT || errno == ENOTDIR)
+    listing->names = htab_create_pow2 (1, htab_hash_string, name_eq, free);
+
+  *slot = listing;
+  return listing;
+}
+
+/* Return false if the listings of DIR and of its subdirectories show
+   that the relative header name FNAME is not there.  Each directory
+   along the way is read the first time it is needed.  */
+static bool
+listing_may_contain (cpp_reader *pfile, cpp_dir *dir, const char *fname)
+{
+  size_t dlen = dir->len;
+  size_t flen = strlen (fname);
+  char *path = (char *) alloca (dlen + 1 + flen + 1);
+  const char *name = fname;
+  bool result = true;
+
+  memcpy (path, dir->name, dlen);
+  while (dlen > 1 && IS_DIR_SEPARATOR (path[dlen - 1]))
+    dlen--;
+  path[dlen] = '\0';
+
+  for (;;)
+    {
+      struct dir_listing *listing;
+      size_t len = 0;
+
+      while (name[len] && !IS_DIR_SEPARATOR (name[len]))
+        len++;
+      /* Leave "." and ".." and empty components to the file system.  */
+      if (len == 0 || (name[0] == '.'
+                       && (len == 1 || (len == 2 && name[1] == '.'))))
+        break;
+
+      listing = read_dir_listing (pfile, path);
+      if (!listing->names)
+        break;
+
+      if (dlen && !IS_DIR_SEPARATOR (path[dlen - 1]))
+        path[dlen++] = '/';
+      memcpy (path + dlen, name, len);
+      dlen += len;
+      path[dlen] = '\0';
+      if (!htab_find (listing->names, path + dlen - len))
+        {
+          result = false;
+          break;
+        }
+
+      if (!name[len])
+        break;
+      name += len + 1;
+    }
+
+  return result;
+}
+
+/* Return true if FILE->name is known not to be in FILE->dir without
+   trying to open it, because -fcache-include-dirs applies to the
+   directory and its listings do not have it.  */
+static bool
+file_known_missing (cpp_reader *pfile, _cpp_file *file)
+{
+  enum cpp_cache_dirs which = CPP_OPTION (pfile, cache_include_dirs);
+  cpp_dir *dir = file->dir;
+  bool missing;
+
+  if (which == CPP_CACHE_DIRS_NONE
+      || CPP_OPTION (pfile, remap)
+      || dir->construct
+      || dir == &pfile->no_search_path
+      || IS_ABSOLUTE_PATH (file->name))
+    return false;
+
+  /* Only system and wrapper directories are taken to stay the same
+     for the whole run with -fcache-include-dirs=system.  */
+  if (which == CPP_CACHE_DIRS_SYSTEM && !dir->sysp)
+    {
+      cpp_dir *wrapper;
+
+      for (wrapper = pfile->wrapper_include; wrapper; wrapper = wrapper->next)
+        if (wrapper == dir || wrapper == pfile->wrapper_include_last)
+          break;
+      if (wrapper != dir)
+        return false;
+    }
+
+  missing = !listing_may_contain (pfile, dir, file->name);
+
+  /* A precompiled header can stand in for a header that is missing.  */
+  if (missing && pfile->cb.valid_pch)
+    {
+      size_t len = strlen (file->name);
+      char *pchname = (char *) alloca (len + sizeof ".gch");
+
+      memcpy (pchname, file->name, len);
+      memcpy (pchname + len, ".gch", sizeof ".gch");
+      missing = !listing_may_contain (pfile, dir, pchname);
+    }
+
+  return missing;
+}
+
+/* Hash and equality functions for the dir_listing_hash table, whose
+   entries are found by path.  */
+static hashval_t
+dir_listing_hash (const void *p)
+{
+  return htab_hash_string (((const struct dir_listing *) p)->path);
+}
+
+static int
+dir_listing_eq (const void *p, const void *q)
+{
+  return strcmp (((const struct dir_listing *) p)->path,
+                 (const char *) q) == 0;
+}
+
+static void
+dir_listing_free (void *p)
+{
+  struct dir_listing *listing = (struct dir_listing *) p;
+
+  if (listing->names)
+    htab_delete (listing->names);
+  free ((void *) listing->path);
+  free (listing);
+}
+
+/* Equality function for the names in a dir_listing.  */
+static int
+name_eq (const void *p, const void *q)
+{
+  return strcmp ((const char *) p, (const char *) q) == 0;
+}
+
+/* Return a copy of PATH in the spelling virtual_file_hash uses: with
+   every separator a single '/', and without "." components or ".."
+   components and the directory names they cancel.  This is done on
+   the text alone, so that a file or directory that only exists in
+   memory is found by every name the preprocessor may form for it.  */
+static char *
+virtual_path (const char *path)
+{
+  char *result = XNEWVEC (char, strlen (path) + 2);
+  char *out = result;
+  size_t root = 0;
+
+  if (IS_DIR_SEPARATOR (*path))
+    {
+      *out++ = '/';
+      root = 1;
+    }
+
+  while (*path)
+    {
+      const char *name;
+      size_t len;
+
+      while (IS_DIR_SEPARATOR (*path))
+        path++;
+      name = path;
+      while (*path && !IS_DIR_SEPARATOR (*path))
+        path++;
+      len = path - name;
+
+      if (len == 0 || (len == 1 && name[0] == '.'))
+        continue;
+
+      /* Let ".." cancel the name before it, unless that is ".." too.  */
+      if (len == 2 && name[0] == '.' && name[1] == '.')
+        {
+          char *last = out;
+
+          while (last > result + root && last[-1] != '/')
+            last--;
+          if (last < out && !(out - last == 2 && last[0] == '.'
+                              && last[1] == '.'))
+            {
+              out = last > result + root ? last - 1 : last;
+              continue;
+            }
+          /* Nothing is above the root.  */
+          if (root && out == result + root)
+            continue;
+        }
+
+      if (out > result + root)
+        *out++ = '/';
+      memcpy (out, name, len);
+      out += len;
+    }
+
+  if (out == result)
+    *out++ = '.';
+  *out = '\0';
+  return result;
+}
+
+/* Return the file or directory given for PATH, if any.  */
+static const struct virtual_file *
+find_virtual_file (cpp_reader *pfile, const char *path)
+{
+  const struct virtual_file *virt;
+  char *key;
+
+  if (!pfile->virtual_file_hash)
+    return NULL;
+
+  key = virtual_path (path);
+  virt = (const struct virtual_file *)
+    htab_find_with_hash (pfile->virtual_file_hash, key,
+                         htab_hash_string (key));
+  free (key);
+  return virt;
+}
+
+/* Fill in *ST as stat would for VIRT.  The modification time is 0, so
+   two virtual files are only compared by contents, for #pragma once,
+   when they also have the same size.  */
+static void
+stat_virtual_file (const struct virtual_file *virt, struct stat *st)
+{
+  memset (st, 0, sizeof (*st));
+  st->st_dev = VIRTUAL_FILE_DEV;
+  st->st_ino = virt->ino;
+  if (virt->dir)
+    st->st_mode = S_IFDIR | 0555;
+  else
+    {
+      st->st_mode = S_IFREG | 0444;
+      st->st_size = virt->len;
+    }
+}
+
+/* If cpp_add_virtual_file gave the contents of FILE->path, use them
+   for FILE and return true.  The file is then treated as a regular
+   file that was opened successfully, under the path it was given
+   with, which is what the line maps and the dump see.  */
+static bool
+open_virtual_file (cpp_reader *pfile, _cpp_file *file)
+{
+  const struct virtual_file *virt = find_virtual_file (pfile, file->path);
+
+  if (!virt || virt->dir)
+    return false;
+
+  if (strcmp (file->path, virt->path))
+    {
+      free ((void *) file->path);
+      file->path = xstrdup (virt->path);
+    }
+  file->virt = virt;
+  stat_virtual_file (virt, &file->st);
+  file->err_no = 0;
+  return true;
+}
+
+/* The read_file_guts of a file opened by open_virtual_file.  */
+static bool
+read_virtual_file (cpp_reader *pfile, _cpp_file *file)
+{
+  const struct virtual_file *virt = file->virt;
+  uchar *buf = XNEWVEC (uchar, virt->len + 1);
+
+  memcpy (buf, virt->buffer, virt->len);
+  file->buffer = _cpp_convert_input (pfile, CPP_OPTION (pfile, input_charset),
+                                     buf, virt->len, virt->len,
+                                     &file->st.st_size);
+  file->buffer_valid = true;
+  return true;
+}
+
+/* Hash and equality functions for the virtual_file_hash table, whose
+   entries are found by path.  */
+static hashval_t
+virtual_file_hash (const void *p)
+{
+  return htab_hash_string (((const struct virtual_file *) p)->path);
+}
+
+static int
+virtual_file_eq (const void *p, const void *q)
+{
+  return strcmp (((const struct virtual_file *) p)->path,
+                 (const char *) q) == 0;
+}
+
+static void
+virtual_file_free (void *p)
+{
+  struct virtual_file *virt = (struct virtual_file *) p;
+
+  free ((void *) virt->path);
+  free (virt);
+}
+
+/* Return the entry for the path KEY, as spelled by virtual_path,
+   creating a directory entry for it if there is none.  Takes ownership
+   of KEY.  */
+static struct virtual_file *
+enter_virtual_file (cpp_reader *pfile, char *key)
+{
+  struct virtual_file *virt;
+  void **slot;
+
+  slot = htab_find_slot_with_hash (pfile->virtual_file_hash, key,
+                                   htab_hash_string (key), INSERT);
+  if (*slot)
+    {
+      free (key);
+      return (struct virtual_file *) *slot;
+    }
+
+  virt = XCNEW (struct virtual_file);
+  virt->path = key;
+  virt->dir = true;
+  virt->ino = htab_elements (pfile->virtual_file_hash);
+  *slot = virt;
+  return virt;
+}
+
+/* Make PATH read as the LEN bytes at BUFFER instead of whatever the
+   file system has there, if anything.  Every directory leading to PATH
+   then exists for the include chains too, as cpp_stat_virtual_file
+   reports.  A later call for the same path replaces the contents.
+   Return false and change nothing if PATH is already a directory
+   leading to another virtual file, or if one of its directories is
+   already a virtual file.  BUFFER must stay valid as long as PFILE;
+   PATH is copied.  */
+bool
+cpp_add_virtual_file (cpp_reader *pfile, const char *path,
+                      const unsigned char *buffer, size_t len)
+{
+  struct virtual_file *virt;
+  char *key = virtual_path (path);
+  char *sep;
+
+  if (!pfile->virtual_file_hash)
+    pfile->virtual_file_hash = htab_create_alloc (31, virtual_file_hash,
+                                                  virtual_file_eq,
+                                                  virtual_file_free,
+                                                  xcalloc, free);
+
+  /* Check the whole path before entering any of it.  */
+  for (sep = strchr (key + 1, '/'); sep; sep = strchr (sep + 1, '/'))
+    {
+      *sep = '\0';
+      virt = (struct virtual_file *)
+        htab_find_with_hash (pfile->virtual_file_hash, key,
+                             htab_hash_string (key));
+      *sep = '/';
+      if (virt && !virt->dir)
+        {
+          free (key);
+          return false;
+        }
+    }
+  virt = (struct virtual_file *)
+    htab_find_with_hash (pfile->virtual_file_hash, key,
+                         htab_hash_string (key));
+  if (virt && virt->dir)
+    {
+      free (key);
+      return false;
+    }
+
+  /* Enter the directories first, so they are numbered outermost
+     first.  */
+  for (sep = strchr (key + 1, '/'); sep; sep = strchr (sep + 1, '/'))
+    enter_virtual_file (pfile, xstrndup (key, sep - key));
+
+  virt = enter_virtual_file (pfile, key);
+  virt->dir = false;
+  virt->buffer = buffer;
+  virt->len = len;
+  return true;
+}
+
+/* If PATH names a file given by cpp_add_virtual_file or a directory
+   leading to one, fill in *ST as stat would and return true.  */
+bool
+cpp_stat_virtual_file (cpp_reader *pfile, const char *path, struct stat *st)
+{
+  const struct virtual_file *virt = find_virtual_file (pfile, path);
+
+  if (!virt)
+    return false;
+
+  stat_virtual_file (virt, st);
+  return true;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Return tue iff the missing_header callback found the given HEADER.  */
 static bool
 search_path_exhausted (cpp_reader *pfile, const char *header, _cpp_file *file)
@@ -593,6 +1097,14 @@ read_file (cpp_reader *pfile, _cpp_file *file)
   if (file->dont_read || file->err_no)
     return false;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (file->virt)
+    {
+      file->dont_read = !read_virtual_file (pfile, file);
+      return !file->dont_read;
+    }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   if (file->fd == -1 && !open_file (file))
     {
       open_file_failed (pfile, file, 0);
@@ -685,6 +1197,9 @@ should_stack_file (cpp_reader *pfile, _cpp_file *file, bool import)
                  the file is still stacked.  Make a new one.  */
               ref_file = make_cpp_file (pfile, f->dir, f->name);
               ref_file->path = f->path;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+              ref_file->virt = f->virt;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
             }
           else
             /* The file is not stacked anymore.  We can reuse it.  */
@@ -1054,10 +1569,17 @@ file_hash_eq (const void *p, const void *q)
 void
 _cpp_init_files (cpp_reader *pfile)
 {
-  pfile->file_hash = htab_create_alloc (127, file_hash_hash, file_hash_eq,
-                                        NULL, xcalloc, free);
-  pfile->dir_hash = htab_create_alloc (127, file_hash_hash, file_hash_eq,
-                                        NULL, xcalloc, free);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  pfile->file_hash = htab_create_pow2_alloc (127, file_hash_hash,
+                                             file_hash_eq, NULL,
+                                             xcalloc, free);
+  pfile->dir_hash = htab_create_pow2_alloc (127, file_hash_hash,
+                                            file_hash_eq, NULL,
+                                            xcalloc, free);
+  pfile->dir_listing_hash = htab_create_pow2 (31, dir_listing_hash,
+                                              dir_listing_eq,
+                                              dir_listing_free);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   allocate_file_hash_entries (pfile);
 }
 
@@ -1067,6 +1589,11 @@ _cpp_cleanup_files (cpp_reader *pfile)
 {
   htab_delete (pfile->file_hash);
   htab_delete (pfile->dir_hash);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  htab_delete (pfile->dir_listing_hash);
+  if (pfile->virtual_file_hash)
+    htab_delete (pfile->virtual_file_hash);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* Enter a file name in the hash for the sake of cpp_included.  */
@@ -1546,6 +2073,12 @@ _cpp_save_file_entries (cpp_reader *pfile, FILE *fp)
       if (f->buffer_valid)
         md5_buffer ((const char *)f->buffer,
                     f->st.st_size, result->entries[count].sum);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      /* A virtual file cannot be opened again once it is read.  */
+      else if (f->virt)
+        md5_buffer ((const char *)f->virt->buffer,
+                    f->virt->len, result->entries[count].sum);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
       else
         {
           FILE *ff;
@@ -242,6 +242,12 @@ typedef CPPCHAR_SIGNED_T cppchar_signed_t;
 /* Style of header dependencies to generate.  */
 enum cpp_deps_style { DEPS_NONE = 0, DEPS_USER, DEPS_SYSTEM };
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Which include directories have their listings cached.  */
+enum cpp_cache_dirs { CPP_CACHE_DIRS_NONE = 0, CPP_CACHE_DIRS_SYSTEM,
+                      CPP_CACHE_DIRS_ALL };
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* The possible normalization levels, from most restrictive to least.  */
 enum cpp_normalize_level {
   /* In NFKC.  */
@@ -348,6 +354,12 @@ struct cpp_options
      names.  */
   unsigned char remap;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* Which include directories are read once with readdir, so that
+     names they do not contain are not opened.  */
+  enum cpp_cache_dirs cache_include_dirs;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
   /* Zero means dollar signs are punctuation.  */
   unsigned char dollars_in_ident;
 
@@ -667,6 +679,12 @@ extern int cpp_finish (cpp_reader *, FILE *deps_stream);
    cpp_errors (pfile).  */
 extern void cpp_destroy (cpp_reader *);
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Call this after the final CPP_EOF to free the memory only needed
+   while lexing.  The handle must still be finished and destroyed.  */
+extern void cpp_release_parse_memory (cpp_reader *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Error count.  */
 extern unsigned int cpp_errors (cpp_reader *);
 
@@ -837,6 +855,12 @@ extern cpp_dir *cpp_get_dir (struct _cpp_file *);
 extern cpp_buffer *cpp_get_buffer (cpp_reader *);
 extern struct _cpp_file *cpp_get_file (cpp_buffer *);
 extern cpp_buffer *cpp_get_prev (cpp_buffer *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+struct stat;
+extern bool cpp_add_virtual_file (cpp_reader *, const char *,
+                                  const unsigned char *, size_t);
+extern bool cpp_stat_virtual_file (cpp_reader *, const char *, struct stat *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* In cpppch.c */
 struct save_macro_data;
@@ -847,6 +871,9 @@ extern int cpp_valid_state (cpp_reader *, const char *, int);
 extern void cpp_prepare_state (cpp_reader *, struct save_macro_data **);
 extern int cpp_read_state (cpp_reader *, const char *, FILE *,
                            struct save_macro_data *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void cpp_discard_state (cpp_reader *, struct save_macro_data *);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #ifdef __cplusplus
 }
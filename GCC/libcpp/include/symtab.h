@@ -39,20 +39,42 @@ typedef struct ht_identifier *hashnode;
 
 enum ht_lookup_option {HT_NO_INSERT = 0, HT_ALLOC, HT_ALLOCED};
 
-/* An identifier hash table for cpplib and the front ends.  */
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* A slot array of an identifier hash table.  A table replaces its
+   array when it grows instead of modifying it in place.  */
+struct ht_slots
+{
+  unsigned int nslots;                /* Total slots, a power of two.  */
+  /* The array this one replaced, when it must outlive it.  */
+  struct ht_slots *retired;
+  hashnode entries[1];
+};
+
+/* Insertion state for a subset of the identifiers; see symtab.c.  */
+struct ht_shard;
+
+/* An identifier hash table for cpplib and the front ends.  Looking up
+   an existing identifier takes no lock, and inserting one locks only
+   its shard, so the table may be shared between threads.  It then must
+   be marked with ht_set_threaded, ALLOC_NODE must be safe to call
+   concurrently, and the strings of HT_ALLOCED lookups must be built on
+   the obstack returned by ht_alloced_stack.  */
 struct ht
 {
-  /* Identifiers are allocated from here.  */
+  /* Strings passed to HT_ALLOCED lookups are built here.  */
   struct obstack stack;
+  /* Held from ht_alloced_stack to the HT_ALLOCED lookup in a threaded
+     table.  */
+  unsigned char stack_lock;
 
-  hashnode *entries;
+  struct ht_slots *slots;
+  struct ht_shard *shards;
   /* Call back, allocate a node.  */
   hashnode (*alloc_node) (hash_table *);
   /* Call back, allocate something that hangs off a node like a cpp_macro.  
      NULL means use the usual allocator.  */
   void * (*alloc_subobject) (size_t);
 
-  unsigned int nslots;                /* Total slots in the entries array.  */
   unsigned int nelements;        /* Number of live elements.  */
 
   /* Link to reader, if any.  For the benefit of cpplib.  */
@@ -62,9 +84,12 @@ struct ht
   unsigned int searches;
   unsigned int collisions;
 
-  /* Should 'entries' be freed when it is no longer needed?  */
-  bool entries_owned;
+  /* Set by ht_set_threaded while more than one thread may use the
+     table.  Replaced slot arrays are then kept, since a reader may
+     still be probing them, and usage statistics are not gathered.  */
+  bool threaded;
 };
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Initialize the hashtable with 2 ^ order entries.  */
 extern hash_table *ht_create (unsigned int order);
@@ -77,6 +102,17 @@ extern hashnode ht_lookup (hash_table *, const unsigned char *,
 extern hashnode ht_lookup_with_hash (hash_table *, const unsigned char *,
                                      size_t, unsigned int,
                                      enum ht_lookup_option);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Return the obstack on which to build the string of an HT_ALLOCED
+   lookup.  In a threaded table the obstack is locked until that
+   lookup returns.  */
+extern struct obstack *ht_alloced_stack (hash_table *);
+
+/* Mark whether more than one thread may use TABLE.  No other thread
+   may be using it when this is called.  */
+extern void ht_set_threaded (hash_table *, bool);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 #define HT_HASHSTEP(r, c) ((r) * 67 + ((c) - 113));
 #define HT_HASHFINISH(r, len) ((r) + (len))
 
@@ -86,7 +122,10 @@ extern hashnode ht_lookup_with_hash (hash_table *, const unsigned char *,
 typedef int (*ht_cb) (struct cpp_reader *, hashnode, const void *);
 extern void ht_forall (hash_table *, ht_cb, const void *);
 
-/* Restore the hash table.  */
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Restore the hash table.  ENTRIES is copied, and freed afterwards if
+   OWN.  */
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern void ht_load (hash_table *ht, hashnode *entries,
                      unsigned int nslots, unsigned int nelements, bool own);
 
@@ -277,6 +277,54 @@ cpp_destroy (cpp_reader *pfile)
   free (pfile);
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Discard a macro definition.  Suitable for cpp_forall_identifiers.  */
+static int
+release_macro (cpp_reader *pfile ATTRIBUTE_UNUSED, cpp_hashnode *node,
+               void *v ATTRIBUTE_UNUSED)
+{
+  if (node->type == NT_MACRO && !(node->flags & NODE_BUILTIN))
+    {
+      node->type = NT_VOID;
+      node->value.macro = NULL;
+    }
+  return 1;
+}
+
+/* Free the memory PFILE only needs while lexing, once the client has
+   read the final CPP_EOF and will lex no more: the spare buffers, the
+   token runs past the current one, the macro expansion buffer and,
+   unless cpp_finish will warn about unused macros, the macro
+   definitions, which then become garbage.  PFILE must still be passed
+   to cpp_finish and cpp_destroy.  */
+void
+cpp_release_parse_memory (cpp_reader *pfile)
+{
+  tokenrun *run, *runn;
+
+  _cpp_free_buff (pfile->free_buffs);
+  pfile->free_buffs = NULL;
+
+  for (run = pfile->cur_run->next; run; run = runn)
+    {
+      runn = run->next;
+      free (run->base);
+      free (run);
+    }
+  pfile->cur_run->next = NULL;
+
+  if (pfile->macro_buffer)
+    {
+      free (pfile->macro_buffer);
+      pfile->macro_buffer = NULL;
+      pfile->macro_buffer_len = 0;
+    }
+
+  if (!CPP_OPTION (pfile, warn_unused_macros))
+    cpp_forall_identifiers (pfile, release_macro, NULL);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* This structure defines one built-in identifier.  A node will be
    entered in the hash table under the name NAME, with value VALUE.
 
@@ -356,6 +356,13 @@ struct cpp_reader
   /* File and directory hash table.  */
   struct htab *file_hash;
   struct htab *dir_hash;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  /* Listings of the directories read for -fcache-include-dirs.  */
+  struct htab *dir_listing_hash;
+
+  /* Files given by cpp_add_virtual_file, or NULL if there are none.  */
+  struct htab *virtual_file_hash;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   struct file_hash_entry *file_hash_entries;
   unsigned int file_hash_entries_allocated, file_hash_entries_used;
 
@@ -558,6 +565,9 @@ extern int _cpp_handle_directive (cpp_reader *, int);
 extern void _cpp_define_builtin (cpp_reader *, const char *);
 extern char ** _cpp_save_pragma_names (cpp_reader *);
 extern void _cpp_restore_pragma_names (cpp_reader *, char **);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+extern void _cpp_free_pragma_names (cpp_reader *, char **);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 extern void _cpp_do__Pragma (cpp_reader *);
 extern void _cpp_init_directives (cpp_reader *);
 extern void _cpp_init_internal_pragmas (cpp_reader *);
@@ -621,6 +621,23 @@ cpp_prepare_state (cpp_reader *r, struct save_macro_data **data)
   *data = d;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Free DATA, saved by cpp_prepare_state, when the state is not going
+   to be restored after all.  */
+
+void
+cpp_discard_state (cpp_reader *r, struct save_macro_data *data)
+{
+  size_t i;
+
+  for (i = 0; i < data->count; i++)
+    free (data->defns[i]);
+  free (data->defns);
+  _cpp_free_pragma_names (r, data->saved_pragmas);
+  free (data);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Given a precompiled header that was previously determined to be valid,
    apply all its definitions (and undefinitions) to the current state. 
    DEPNAME is passed to deps_restore.  */
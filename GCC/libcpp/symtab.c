@@ -30,8 +30,62 @@ Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
    existing entry with a potential new one.  Also, the ability to
    delete members from the table has been removed.  */
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The table may be shared between threads.  All of them probe the same
+   slot array, but the identifiers are split into HT_SHARDS shards by
+   the low bits of their hash value, each with its own insertion lock
+   and its own arena for the identifier strings.
+
+   Readers take no lock.  A node is fully initialized before its pointer
+   is stored into a slot, and a grown slot array is fully populated
+   before it replaces the old one, so a reader sees either the old or
+   the new state.  Slots only ever go from NULL to a node.  Inserters of
+   different shards may race for the same empty slot; they claim it with
+   a compare-and-swap and the loser goes on along its probe sequence,
+   since it cannot be inserting the same string.  An inserter counts
+   its node in NELEMENTS before it claims a slot and backs off to grow
+   the table if that would fill more than 3/4 of it, so there is always
+   an empty slot to claim and every probe sequence ends.  Growing the
+   table takes the lock of every shard.
+
+   In a single thread, slots are filled and rehashed exactly as they
+   always were, so ht_forall visits the identifiers in the same order.  */
+
+#define HT_SHARD_BITS 4
+#define HT_SHARDS (1 << HT_SHARD_BITS)
+
+#ifdef HAVE_ATOMIC_BUILTINS
+# define HT_LOAD(P) __atomic_load_n (&(P), __ATOMIC_ACQUIRE)
+# define HT_STORE(P, V) __atomic_store_n (&(P), (V), __ATOMIC_RELEASE)
+# define HT_INCREMENT(N) __atomic_add_fetch (&(N), 1, __ATOMIC_RELAXED)
+# define HT_DECREMENT(N) __atomic_sub_fetch (&(N), 1, __ATOMIC_RELAXED)
+#else
+# define HT_LOAD(P) (P)
+# define HT_STORE(P, V) ((P) = (V))
+# define HT_INCREMENT(N) (++(N))
+# define HT_DECREMENT(N) (--(N))
+#endif
+
+struct ht_shard
+{
+  /* Insertion lock.  */
+  unsigned char lock;
+
+  /* Strings of HT_ALLOC insertions are copied here.  */
+  struct obstack stack;
+};
+
 static unsigned int calc_hash (const unsigned char *, size_t);
-static void ht_expand (hash_table *);
+static void ht_lock (unsigned char *);
+static void ht_unlock (unsigned char *);
+static void ht_alloced_done (hash_table *, const unsigned char *, bool);
+static bool ht_claim (hashnode *, hashnode);
+static struct ht_slots *alloc_slots (unsigned int);
+static void free_slots (struct ht_slots *);
+static hashnode ht_probe (struct ht_slots *, const unsigned char *, size_t,
+                          unsigned int, unsigned int *, unsigned int *);
+static void ht_place (struct ht_slots *, hashnode);
+static void ht_expand (hash_table *, struct ht_slots *);
 static double approx_sqrt (double);
 
 /* Calculate the hash of the string STR of length LEN.  */
@@ -48,6 +102,74 @@ calc_hash (const unsigned char *str, size_t len)
   return HT_HASHFINISH (r, len);
 }
 
+/* Take LOCK, the insertion lock of a shard or the lock of the
+   HT_ALLOCED obstack.  Without atomic builtins the table is only safe
+   for a single thread.  */
+
+static inline void
+ht_lock (unsigned char *lock ATTRIBUTE_UNUSED)
+{
+#ifdef HAVE_ATOMIC_BUILTINS
+  while (__atomic_test_and_set (lock, __ATOMIC_ACQUIRE))
+    while (__atomic_load_n (lock, __ATOMIC_RELAXED))
+      ;
+#endif
+}
+
+/* Release LOCK.  */
+
+static inline void
+ht_unlock (unsigned char *lock ATTRIBUTE_UNUSED)
+{
+#ifdef HAVE_ATOMIC_BUILTINS
+  __atomic_clear (lock, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Store NODE into SLOT if it is still empty.  Return whether it was.  */
+
+static inline bool
+ht_claim (hashnode *slot, hashnode node)
+{
+#ifdef HAVE_ATOMIC_BUILTINS
+  hashnode empty = NULL;
+
+  return __atomic_compare_exchange_n (slot, &empty, node, false,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#else
+  if (*slot)
+    return false;
+  *slot = node;
+  return true;
+#endif
+}
+
+/* Allocate an empty slot array of NSLOTS entries.  */
+
+static struct ht_slots *
+alloc_slots (unsigned int nslots)
+{
+  struct ht_slots *slots;
+
+  slots = XCNEWVAR (struct ht_slots, (offsetof (struct ht_slots, entries)
+                                      + nslots * sizeof (hashnode)));
+  slots->nslots = nslots;
+  return slots;
+}
+
+/* Free SLOTS and every array it retired.  */
+
+static void
+free_slots (struct ht_slots *slots)
+{
+  while (slots)
+    {
+      struct ht_slots *next = slots->retired;
+      free (slots);
+      slots = next;
+    }
+}
+
 /* Initialize an identifier hashtable.  */
 
 hash_table *
@@ -55,6 +177,7 @@ ht_create (unsigned int order)
 {
   unsigned int nslots = 1 << order;
   hash_table *table;
+  unsigned int i;
 
   table = XCNEW (hash_table);
 
@@ -65,9 +188,15 @@ ht_create (unsigned int order)
 
   obstack_alignment_mask (&table->stack) = 0;
 
-  table->entries = XCNEWVEC (hashnode, nslots);
-  table->entries_owned = true;
-  table->nslots = nslots;
+  table->slots = alloc_slots (nslots);
+  table->shards = XCNEWVEC (struct ht_shard, HT_SHARDS);
+  for (i = 0; i < HT_SHARDS; i++)
+    {
+      _obstack_begin (&table->shards[i].stack, 0, 0,
+                      (void *(*) (long)) xmalloc,
+                      (void (*) (void *)) free);
+      obstack_alignment_mask (&table->shards[i].stack) = 0;
+    }
   return table;
 }
 
@@ -76,12 +205,98 @@ ht_create (unsigned int order)
 void
 ht_destroy (hash_table *table)
 {
+  unsigned int i;
+
+  for (i = 0; i < HT_SHARDS; i++)
+    obstack_free (&table->shards[i].stack, NULL);
+  free (table->shards);
+  free_slots (table->slots);
   obstack_free (&table->stack, NULL);
-  if (table->entries_owned)
-    free (table->entries);
   free (table);
 }
 
+/* Return the obstack on which to build the string of an HT_ALLOCED
+   lookup, locking it in a threaded table.  */
+
+struct obstack *
+ht_alloced_stack (hash_table *table)
+{
+  if (table->threaded)
+    ht_lock (&table->stack_lock);
+  return &table->stack;
+}
+
+/* Finish an HT_ALLOCED lookup of STR, which is at the top of
+   TABLE->STACK.  If it was FOUND the string is not needed any more.  */
+
+static void
+ht_alloced_done (hash_table *table, const unsigned char *str, bool found)
+{
+  if (found)
+    obstack_free (&table->stack, (void *) str);
+  if (table->threaded)
+    ht_unlock (&table->stack_lock);
+}
+
+/* Mark whether more than one thread may use TABLE.  Once it is back to
+   a single thread, the slot arrays kept for readers can go.  */
+
+void
+ht_set_threaded (hash_table *table, bool threaded)
+{
+  if (!threaded)
+    {
+      free_slots (table->slots->retired);
+      table->slots->retired = NULL;
+    }
+  table->threaded = threaded;
+}
+
+/* Look for STR of length LEN and hash HASH in SLOTS.  Return the node
+   if it is found.  Otherwise return NULL and set *INDEX to the empty
+   slot that ends the probe sequence.  Add the number of slots probed in
+   vain to *COLLISIONS.  */
+
+static inline hashnode
+ht_probe (struct ht_slots *slots, const unsigned char *str, size_t len,
+          unsigned int hash, unsigned int *index, unsigned int *collisions)
+{
+  unsigned int sizemask = slots->nslots - 1;
+  unsigned int i = hash & sizemask;
+  unsigned int hash2;
+  hashnode node;
+
+  node = HT_LOAD (slots->entries[i]);
+  if (node != NULL)
+    {
+      if (node->hash_value == hash
+          && HT_LEN (node) == (unsigned int) len
+          && !memcmp (HT_STR (node), str, len))
+        return node;
+
+      /* hash2 must be odd, so we're guaranteed to visit every possible
+         location in the table during rehashing.  */
+      hash2 = ((hash * 17) & sizemask) | 1;
+
+      for (;;)
+        {
+          (*collisions)++;
+          i = (i + hash2) & sizemask;
+          node = HT_LOAD (slots->entries[i]);
+          if (node == NULL)
+            break;
+
+          if (node->hash_value == hash
+              && HT_LEN (node) == (unsigned int) len
+              && !memcmp (HT_STR (node), str, len))
+            return node;
+        }
+    }
+
+  *index = i;
+  return NULL;
+}
+
 /* Returns the hash entry for the a STR of length LEN.  If that string
    already exists in the table, returns the existing entry, and, if
    INSERT is CPP_ALLOCED, frees the last obstack object.  If the
@@ -89,7 +304,8 @@ ht_destroy (hash_table *table)
    returns NULL.  Otherwise insert and returns a new entry.  A new
    string is alloced if INSERT is CPP_ALLOC, otherwise INSERT is
    CPP_ALLOCED and the item is assumed to be at the top of the
-   obstack.  */
+   obstack.  In a threaded table that obstack must have been obtained
+   from ht_alloced_stack, and the lookup releases it.  */
 hashnode
 ht_lookup (hash_table *table, const unsigned char *str, size_t len,
            enum ht_lookup_option insert)
@@ -103,116 +319,141 @@ ht_lookup_with_hash (hash_table *table, const unsigned char *str,
                      size_t len, unsigned int hash,
                      enum ht_lookup_option insert)
 {
-  unsigned int hash2;
-  unsigned int index;
-  size_t sizemask;
+  struct ht_slots *slots = HT_LOAD (table->slots);
+  struct ht_shard *shard;
+  unsigned int index, sizemask, hash2, nelements;
+  unsigned int collisions = 0;
   hashnode node;
 
-  sizemask = table->nslots - 1;
-  index = hash & sizemask;
-  table->searches++;
+  node = ht_probe (slots, str, len, hash, &index, &collisions);
+  if (!table->threaded)
+    {
+      table->searches++;
+      table->collisions += collisions;
+    }
 
-  node = table->entries[index];
- 
   if (node != NULL)
     {
-      if (node->hash_value == hash
-          && HT_LEN (node) == (unsigned int) len
-          && !memcmp (HT_STR (node), str, len))
-        {
-          if (insert == HT_ALLOCED)
-            /* The string we search for was placed at the end of the
-               obstack.  Release it.  */
-            obstack_free (&table->stack, (void *) str);
-          return node;
-        }
+      if (insert == HT_ALLOCED)
+        /* The string we search for was placed at the end of the
+           obstack.  Release it.  */
+        ht_alloced_done (table, str, true);
+      return node;
+    }
 
-      /* hash2 must be odd, so we're guaranteed to visit every possible
-         location in the table during rehashing.  */
-      hash2 = ((hash * 17) & sizemask) | 1;
+  if (insert == HT_NO_INSERT)
+    return NULL;
 
-      for (;;)
-        {
-          table->collisions++;
-          index = (index + hash2) & sizemask;
-          node = table->entries[index];
-          if (node == NULL)
-            break;
+  shard = &table->shards[hash & (HT_SHARDS - 1)];
+  for (;;)
+    {
+      ht_lock (&shard->lock);
 
-          if (node->hash_value == hash
-              && HT_LEN (node) == (unsigned int) len
-              && !memcmp (HT_STR (node), str, len))
+      /* The string can only have been inserted since we probed by
+         another thread of this shard, which would have had to fill our
+         empty slot or grow the table.  */
+      if (table->slots != slots || HT_LOAD (slots->entries[index]) != NULL)
+        {
+          slots = table->slots;
+          node = ht_probe (slots, str, len, hash, &index, &collisions);
+          if (node != NULL)
             {
+              ht_unlock (&shard->lock);
               if (insert == HT_ALLOCED)
-              /* The string we search for was placed at the end of the
-                 obstack.  Release it.  */
-                obstack_free (&table->stack, (void *) str);
+                ht_alloced_done (table, str, true);
               return node;
             }
         }
-    }
 
-  if (insert == HT_NO_INSERT)
-    return NULL;
+      /* Count the new node before claiming a slot for it, so the
+         threads of all shards together never fill more than 3/4 of
+         SLOTS.  A table that is full to that point is still waiting
+         for the thread that filled it to grow it; do that here.  */
+      nelements = HT_INCREMENT (table->nelements);
+      if (nelements * 4 <= slots->nslots * 3)
+        break;
+      HT_DECREMENT (table->nelements);
+      ht_unlock (&shard->lock);
+      ht_expand (table, slots);
+    }
 
   node = (*table->alloc_node) (table);
-  table->entries[index] = node;
-
   HT_LEN (node) = (unsigned int) len;
   node->hash_value = hash;
   if (insert == HT_ALLOC)
-    HT_STR (node) = (const unsigned char *) obstack_copy0 (&table->stack,
+    HT_STR (node) = (const unsigned char *) obstack_copy0 (&shard->stack,
                                                            str, len);
   else
     HT_STR (node) = str;
 
-  if (++table->nelements * 4 >= table->nslots * 3)
+  sizemask = slots->nslots - 1;
+  hash2 = ((hash * 17) & sizemask) | 1;
+  while (!ht_claim (&slots->entries[index], node))
+    do
+      index = (index + hash2) & sizemask;
+    while (HT_LOAD (slots->entries[index]) != NULL);
+
+  ht_unlock (&shard->lock);
+  if (insert == HT_ALLOCED)
+    ht_alloced_done (table, str, false);
+
+  if (nelements * 4 >= slots->nslots * 3)
     /* Must expand the string table.  */
-    ht_expand (table);
+    ht_expand (table, slots);
 
   return node;
 }
 
-/* Double the size of a hash table, re-hashing existing entries.  */
+/* Put NODE, which is not yet in SLOTS, into its first free slot.  */
 
 static void
-ht_expand (hash_table *table)
+ht_place (struct ht_slots *slots, hashnode node)
 {
-  hashnode *nentries, *p, *limit;
-  unsigned int size, sizemask;
+  unsigned int sizemask = slots->nslots - 1;
+  unsigned int hash = node->hash_value;
+  unsigned int index = hash & sizemask;
+
+  if (slots->entries[index])
+    {
+      unsigned int hash2 = ((hash * 17) & sizemask) | 1;
+      do
+        index = (index + hash2) & sizemask;
+      while (slots->entries[index]);
+    }
+  slots->entries[index] = node;
+}
 
-  size = table->nslots * 2;
-  nentries = XCNEWVEC (hashnode, size);
-  sizemask = size - 1;
+/* Double the size of a hash table whose slot array is OLD, re-hashing
+   existing entries, unless another thread already did.  */
 
-  p = table->entries;
-  limit = p + table->nslots;
-  do
-    if (*p)
-      {
-        unsigned int index, hash, hash2;
-
-        hash = (*p)->hash_value;
-        index = hash & sizemask;
-
-        if (nentries[index])
-          {
-            hash2 = ((hash * 17) & sizemask) | 1;
-            do
-              {
-                index = (index + hash2) & sizemask;
-              }
-            while (nentries[index]);
-          }
-        nentries[index] = *p;
-      }
-  while (++p < limit);
+static void
+ht_expand (hash_table *table, struct ht_slots *old)
+{
+  struct ht_slots *slots;
+  unsigned int i;
+
+  for (i = 0; i < HT_SHARDS; i++)
+    ht_lock (&table->shards[i].lock);
+
+  if (table->slots == old)
+    {
+      slots = alloc_slots (old->nslots * 2);
+      for (i = 0; i < old->nslots; i++)
+        if (old->entries[i])
+          ht_place (slots, old->entries[i]);
+
+      if (table->threaded)
+        slots->retired = old;
+      else
+        {
+          slots->retired = old->retired;
+          free (old);
+        }
+      HT_STORE (table->slots, slots);
+    }
 
-  if (table->entries_owned)
-    free (table->entries);
-  table->entries_owned = true;
-  table->entries = nentries;
-  table->nslots = size;
+  for (i = 0; i < HT_SHARDS; i++)
+    ht_unlock (&table->shards[i].lock);
 }
 
 /* For all nodes in TABLE, callback CB with parameters TABLE->PFILE,
@@ -220,17 +461,15 @@ ht_expand (hash_table *table)
 void
 ht_forall (hash_table *table, ht_cb cb, const void *v)
 {
-  hashnode *p, *limit;
+  struct ht_slots *slots = HT_LOAD (table->slots);
+  unsigned int i;
 
-  p = table->entries;
-  limit = p + table->nslots;
-  do
-    if (*p)
-      {
-        if ((*cb) (table->pfile, *p, v) == 0)
-          break;
-      }
-  while (++p < limit);
+  for (i = 0; i < slots->nslots; i++)
+    {
+      hashnode node = HT_LOAD (slots->entries[i]);
+      if (node && (*cb) (table->pfile, node, v) == 0)
+        break;
+    }
 }
 
 /* Restore the hash table.  */
@@ -239,13 +478,16 @@ ht_load (hash_table *ht, hashnode *entries,
          unsigned int nslots, unsigned int nelements,
          bool own)
 {
-  if (ht->entries_owned)
-    free (ht->entries);
-  ht->entries = entries;
-  ht->nslots = nslots;
+  struct ht_slots *slots = alloc_slots (nslots);
+
+  memcpy (slots->entries, entries, nslots * sizeof (hashnode));
+  free_slots (ht->slots);
+  ht->slots = slots;
   ht->nelements = nelements;
-  ht->entries_owned = own;
+  if (own)
+    free (entries);
 }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* Dump allocation statistics to stderr.  */
 
@@ -256,6 +498,9 @@ ht_dump_statistics (hash_table *table)
   size_t total_bytes, longest;
   double sum_of_squares, exp_len, exp_len2, exp2_len;
   hashnode *p, *limit;
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  unsigned int i;
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 #define SCALE(x) ((unsigned long) ((x) < 1024*10 \
                   ? (x) \
@@ -265,8 +510,10 @@ ht_dump_statistics (hash_table *table)
 #define LABEL(x) ((x) < 1024*10 ? ' ' : ((x) < 1024*1024*10 ? 'k' : 'M'))
 
   total_bytes = longest = sum_of_squares = nids = 0;
-  p = table->entries;
-  limit = p + table->nslots;
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  p = table->slots->entries;
+  limit = p + table->slots->nslots;
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
   do
     if (*p)
       {
@@ -281,15 +528,22 @@ ht_dump_statistics (hash_table *table)
   while (++p < limit);
 
   nelts = table->nelements;
-  overhead = obstack_memory_used (&table->stack) - total_bytes;
-  headers = table->nslots * sizeof (hashnode);
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  overhead = obstack_memory_used (&table->stack);
+  for (i = 0; i < HT_SHARDS; i++)
+    overhead += obstack_memory_used (&table->shards[i].stack);
+  overhead -= total_bytes;
+  headers = table->slots->nslots * sizeof (hashnode);
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   fprintf (stderr, "\nString pool\nentries\t\t%lu\n",
            (unsigned long) nelts);
   fprintf (stderr, "identifiers\t%lu (%.2f%%)\n",
            (unsigned long) nids, nids * 100.0 / nelts);
+  /* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
   fprintf (stderr, "slots\t\t%lu\n",
-           (unsigned long) table->nslots);
+           (unsigned long) table->slots->nslots);
+  /* END GCC-XML MODIFICATIONS 2026-10-18 */
   fprintf (stderr, "bytes\t\t%lu%c (%lu%c overhead)\n",
            SCALE (total_bytes), LABEL (total_bytes),
            SCALE (overhead), LABEL (overhead));
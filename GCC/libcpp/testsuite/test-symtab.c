@@ -0,0 +1,292 @@
+/* Identifier hash table stress test and benchmark.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+This program is free software; you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the
+Free Software Foundation; either version 2, or (at your option) any
+later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.  */
+
+/* Without arguments, THREADS threads share one table that starts with
+   16 slots, so it grows many times while they run.  Each thread looks
+   up the same KEYS identifiers in its own order, inserting them with
+   HT_ALLOC or HT_ALLOCED lookups and looking them up again with
+   HT_NO_INSERT.  Every thread must get the same node for the same
+   string, and the table must end up holding each string once and
+   less than 3/4 full.
+
+   With "-b" it times lookups of existing identifiers instead, first
+   in a table that is not marked threaded and then with 1, 2, 4 and 8
+   threads sharing a threaded table.  */
+
+#include "config.h"
+#include "system.h"
+#include "symtab.h"
+#include <pthread.h>
+#include <sys/time.h>
+
+#define THREADS 8
+#define KEYS 20000
+#define ROUNDS 20
+
+#define BENCH_KEYS 100000
+#define BENCH_LOOKUPS 20000000
+
+struct worker
+{
+  hash_table *table;
+  unsigned int seed;
+  int nkeys;
+  long lookups;
+  hashnode *nodes;
+};
+
+static char (*keys)[16];
+static int failures;
+
+/* Allocate a node.  malloc is thread-safe, unlike the GC allocator
+   the front ends use.  */
+
+static hashnode
+alloc_node (hash_table *table ATTRIBUTE_UNUSED)
+{
+  return XCNEW (struct ht_identifier);
+}
+
+static hash_table *
+make_table (unsigned int order)
+{
+  hash_table *table = ht_create (order);
+
+  table->alloc_node = alloc_node;
+  return table;
+}
+
+/* Shuffle the N indices in PERM with the random sequence of SEED.  */
+
+static void
+shuffle (int *perm, int n, unsigned int seed)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    perm[i] = i;
+  for (i = n - 1; i > 0; i--)
+    {
+      int j, t;
+
+      seed = seed * 1103515245 + 12345;
+      j = (seed >> 8) % (i + 1);
+      t = perm[i];
+      perm[i] = perm[j];
+      perm[j] = t;
+    }
+}
+
+static void *
+stress (void *arg)
+{
+  struct worker *w = (struct worker *) arg;
+  int *perm = XNEWVEC (int, KEYS);
+  int i;
+
+  shuffle (perm, KEYS, w->seed);
+  for (i = 0; i < KEYS; i++)
+    {
+      int k = perm[i];
+      size_t len = strlen (keys[k]);
+      hashnode node;
+
+      if (k % 2)
+        node = ht_lookup (w->table, (const unsigned char *) keys[k], len,
+                          HT_ALLOC);
+      else
+        {
+          struct obstack *stack = ht_alloced_stack (w->table);
+          const unsigned char *str;
+
+          obstack_grow (stack, keys[k], len);
+          str = (const unsigned char *) obstack_finish (stack);
+          node = ht_lookup (w->table, str, len, HT_ALLOCED);
+        }
+      w->nodes[k] = node;
+    }
+
+  for (i = 0; i < KEYS; i++)
+    if (ht_lookup (w->table, (const unsigned char *) keys[i],
+                   strlen (keys[i]), HT_NO_INSERT) != w->nodes[i])
+      {
+        fprintf (stderr, "test-symtab: %s not found again\n", keys[i]);
+        failures++;
+      }
+
+  free (perm);
+  return NULL;
+}
+
+static int
+count_node (struct cpp_reader *pfile ATTRIBUTE_UNUSED,
+            hashnode node ATTRIBUTE_UNUSED, const void *v)
+{
+  ++*(int *) v;
+  return 1;
+}
+
+static void
+check_round (unsigned int round)
+{
+  struct worker workers[THREADS];
+  pthread_t threads[THREADS];
+  hash_table *table = make_table (4);
+  int i, t, n = 0;
+
+  ht_set_threaded (table, true);
+  for (t = 0; t < THREADS; t++)
+    {
+      workers[t].table = table;
+      workers[t].seed = round * THREADS + t + 1;
+      workers[t].nodes = XCNEWVEC (hashnode, KEYS);
+      pthread_create (&threads[t], NULL, stress, &workers[t]);
+    }
+  for (t = 0; t < THREADS; t++)
+    pthread_join (threads[t], NULL);
+  ht_set_threaded (table, false);
+
+  for (i = 0; i < KEYS; i++)
+    {
+      hashnode node = workers[0].nodes[i];
+
+      if (!node
+          || HT_LEN (node) != strlen (keys[i])
+          || memcmp (HT_STR (node), keys[i], HT_LEN (node)))
+        {
+          fprintf (stderr, "test-symtab: bad node for %s\n", keys[i]);
+          failures++;
+        }
+      for (t = 1; t < THREADS; t++)
+        if (workers[t].nodes[i] != node)
+          {
+            fprintf (stderr, "test-symtab: %s inserted twice\n", keys[i]);
+            failures++;
+          }
+    }
+
+  ht_forall (table, count_node, &n);
+  if (n != KEYS || table->nelements != KEYS)
+    {
+      fprintf (stderr, "test-symtab: %d slots used and %u elements "
+               "for %d keys\n", n, table->nelements, KEYS);
+      failures++;
+    }
+  if (table->nelements * 4 >= table->slots->nslots * 3)
+    {
+      fprintf (stderr, "test-symtab: %u elements left in %u slots\n",
+               table->nelements, table->slots->nslots);
+      failures++;
+    }
+
+  for (t = 0; t < THREADS; t++)
+    free (workers[t].nodes);
+  ht_destroy (table);
+}
+
+static double
+now (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void *
+bench_lookups (void *arg)
+{
+  struct worker *w = (struct worker *) arg;
+  unsigned int seed = w->seed;
+  long i;
+
+  for (i = 0; i < w->lookups; i++)
+    {
+      int k;
+
+      seed = seed * 1103515245 + 12345;
+      k = (seed >> 8) % w->nkeys;
+      if (!ht_lookup (w->table, (const unsigned char *) keys[k],
+                      strlen (keys[k]), HT_NO_INSERT))
+        abort ();
+    }
+  return NULL;
+}
+
+static void
+bench (void)
+{
+  hash_table *table = make_table (14);
+  struct worker workers[THREADS];
+  pthread_t threads[THREADS];
+  double start;
+  int i, nthreads;
+
+  for (i = 0; i < BENCH_KEYS; i++)
+    ht_lookup (table, (const unsigned char *) keys[i], strlen (keys[i]),
+               HT_ALLOC);
+
+  workers[0].table = table;
+  workers[0].seed = 1;
+  workers[0].nkeys = BENCH_KEYS;
+  workers[0].lookups = BENCH_LOOKUPS;
+  start = now ();
+  bench_lookups (&workers[0]);
+  printf ("unthreaded  %ld lookups %6.2fs\n", (long) BENCH_LOOKUPS,
+          now () - start);
+
+  ht_set_threaded (table, true);
+  for (nthreads = 1; nthreads <= THREADS; nthreads *= 2)
+    {
+      start = now ();
+      for (i = 0; i < nthreads; i++)
+        {
+          workers[i] = workers[0];
+          workers[i].seed = i + 1;
+          workers[i].lookups = BENCH_LOOKUPS / nthreads;
+          pthread_create (&threads[i], NULL, bench_lookups, &workers[i]);
+        }
+      for (i = 0; i < nthreads; i++)
+        pthread_join (threads[i], NULL);
+      printf ("%d thread%s   %ld lookups %6.2fs\n", nthreads,
+              nthreads == 1 ? " " : "s", (long) BENCH_LOOKUPS,
+              now () - start);
+    }
+  ht_destroy (table);
+}
+
+int
+main (int argc, char **argv)
+{
+  int i, n = BENCH_KEYS > KEYS ? BENCH_KEYS : KEYS;
+  unsigned int round;
+
+  keys = (char (*)[16]) xmalloc (n * 16);
+  for (i = 0; i < n; i++)
+    sprintf (keys[i], "id_%d", i);
+
+  if (argc > 1 && strcmp (argv[1], "-b") == 0)
+    {
+      bench ();
+      return 0;
+    }
+
+  for (round = 0; round < ROUNDS && !failures; round++)
+    check_round (round);
+
+  return failures ? 1 : 0;
+}
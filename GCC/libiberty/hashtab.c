@@ -70,8 +70,17 @@ static hashval_t htab_mod (hashval_t, htab_t);
 static hashval_t htab_mod_m2 (hashval_t, htab_t);
 static hashval_t hash_pointer (const void *);
 static int eq_pointer (const void *, const void *);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static unsigned int higher_pow2_log2 (unsigned long);
+static hashval_t htab_pow2_index (hashval_t, htab_t);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 static int htab_expand (htab_t);
 static PTR *find_empty_slot_for_expand (htab_t, hashval_t);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+static PTR htab_find_with_hash_pow2 (htab_t, const PTR, hashval_t);
+static PTR *htab_find_slot_with_hash_pow2 (htab_t, const PTR, hashval_t,
+                                           enum insert_option);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
 /* At some point, we could make these be NULL, and modify the
    hash-table routines to handle NULL specially; that would avoid
@@ -191,6 +200,31 @@ higher_prime_index (unsigned long n)
   return low;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* The following function returns the base-two logarithm of the
+   smallest power of two which is not less than N.  Power-of-two tables
+   are never smaller than eight entries.  */
+
+static unsigned int
+higher_pow2_log2 (unsigned long n)
+{
+  unsigned int log2 = 3;
+
+  while (((unsigned long) 1 << log2) < n)
+    {
+      /* The probe index is computed in a hashval_t.  */
+      if (log2 >= sizeof (hashval_t) * CHAR_BIT - 1)
+        {
+          fprintf (stderr, "Cannot find power of two bigger than %lu\n", n);
+          abort ();
+        }
+      log2++;
+    }
+
+  return log2;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Returns a hash code for P.  */
 
 static hashval_t
@@ -279,6 +313,21 @@ htab_mod_m2 (hashval_t hash, htab_t htab)
   return 1 + htab_mod_1 (hash, p->prime - 2, p->inv_m2, p->shift);
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Compute the first probe for HASH in the power-of-two table HTAB.
+   This is Fibonacci hashing: the top SIZE_LOG2 bits of the product
+   are used, so hashes whose low bits are all alike (such as those of
+   htab_hash_pointer for objects of a common size) still spread over
+   the whole table.  */
+
+static inline hashval_t
+htab_pow2_index (hashval_t hash, htab_t htab)
+{
+  hashval_t product = (hashval_t) ((hash * 0x9e3779b9U) & 0xffffffffU);
+  return product >> (32 - htab->size_log2);
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* This function creates table with length slightly longer than given
    source length.  Created hash table is initiated as empty (all the
    hash table entries are HTAB_EMPTY_ENTRY).  The function returns the
@@ -350,6 +399,48 @@ htab_create_alloc_ex (size_t size, htab_hash hash_f, htab_eq eq_f,
   return result;
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* Like htab_create_alloc, but the table is sized by powers of two and
+   probed linearly.  This avoids the modulo arithmetic of the prime
+   sized tables on every probe, and when HASH_F and EQ_F are
+   htab_hash_pointer and htab_eq_pointer the entries are compared
+   without calling through the function pointers.  The table is used
+   through the usual htab_* functions; the probing scheme is chosen
+   when the table is created.  */
+
+htab_t
+htab_create_pow2_alloc (size_t size, htab_hash hash_f, htab_eq eq_f,
+                        htab_del del_f, htab_alloc alloc_f, htab_free free_f)
+{
+  htab_t result;
+  unsigned int size_log2;
+
+  size_log2 = higher_pow2_log2 (size);
+  size = (size_t) 1 << size_log2;
+
+  result = (htab_t) (*alloc_f) (1, sizeof (struct htab));
+  if (result == NULL)
+    return NULL;
+  result->entries = (PTR *) (*alloc_f) (size, sizeof (PTR));
+  if (result->entries == NULL)
+    {
+      if (free_f != NULL)
+        (*free_f) (result);
+      return NULL;
+    }
+  result->size = size;
+  result->size_log2 = size_log2;
+  result->pointer_keys = (hash_f == htab_hash_pointer
+                          && eq_f == htab_eq_pointer);
+  result->hash_f = hash_f;
+  result->eq_f = eq_f;
+  result->del_f = del_f;
+  result->alloc_f = alloc_f;
+  result->free_f = free_f;
+  return result;
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* Update the function pointers and allocation parameter in the htab_t.  */
 
 void
@@ -363,6 +454,11 @@ htab_set_functions_ex (htab_t htab, htab_hash hash_f, htab_eq eq_f,
   htab->alloc_arg = alloc_arg;
   htab->alloc_with_arg_f = alloc_f;
   htab->free_with_arg_f = free_f;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  htab->pointer_keys = (htab->size_log2
+                        && hash_f == htab_hash_pointer
+                        && eq_f == htab_eq_pointer);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 /* These functions exist solely for backward compatibility.  */
@@ -424,8 +520,21 @@ htab_empty (htab_t htab)
   /* Instead of clearing megabyte, downsize the table.  */
   if (size > 1024*1024 / sizeof (PTR))
     {
-      int nindex = higher_prime_index (1024 / sizeof (PTR));
-      int nsize = prime_tab[nindex].prime;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+      int nindex = 0;
+      int nsize;
+
+      if (htab->size_log2)
+        {
+          htab->size_log2 = higher_pow2_log2 (1024 / sizeof (PTR));
+          nsize = 1 << htab->size_log2;
+        }
+      else
+        {
+          nindex = higher_prime_index (1024 / sizeof (PTR));
+          nsize = prime_tab[nindex].prime;
+        }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
       if (htab->free_f != NULL)
         (*htab->free_f) (htab->entries);
@@ -455,11 +564,31 @@ htab_empty (htab_t htab)
 static PTR *
 find_empty_slot_for_expand (htab_t htab, hashval_t hash)
 {
-  hashval_t index = htab_mod (hash, htab);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  hashval_t index;
   size_t size = htab_size (htab);
-  PTR *slot = htab->entries + index;
+  PTR *slot;
   hashval_t hash2;
 
+  if (htab->size_log2)
+    {
+      size_t mask = size - 1;
+
+      index = htab_pow2_index (hash, htab);
+      for (;;)
+        {
+          slot = htab->entries + index;
+          if (*slot == HTAB_EMPTY_ENTRY)
+            return slot;
+          else if (*slot == HTAB_DELETED_ENTRY)
+            abort ();
+          index = (index + 1) & mask;
+        }
+    }
+
+  index = htab_mod (hash, htab);
+  slot = htab->entries + index;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   if (*slot == HTAB_EMPTY_ENTRY)
     return slot;
   else if (*slot == HTAB_DELETED_ENTRY)
@@ -496,21 +625,40 @@ htab_expand (htab_t htab)
   PTR *p;
   PTR *nentries;
   size_t nsize, osize, elts;
-  unsigned int oindex, nindex;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  unsigned int oindex, nindex, nlog2;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   oentries = htab->entries;
   oindex = htab->size_prime_index;
   osize = htab->size;
   olimit = oentries + osize;
   elts = htab_elements (htab);
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  nlog2 = htab->size_log2;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
   /* Resize only when table after removal of unused elements is either
      too full or too empty.  */
-  if (elts * 2 > osize || (elts * 8 < osize && osize > 32))
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (elts * 2 > osize || (elts * 8 < osize && osize > 32)
+      || (htab->size_log2 && elts * 2 == osize))
     {
-      nindex = higher_prime_index (elts * 2);
-      nsize = prime_tab[nindex].prime;
+      if (htab->size_log2)
+        {
+          /* Linear probing degrades quickly as the table fills, so
+             power-of-two tables are kept at most half full.  */
+          nindex = oindex;
+          nlog2 = higher_pow2_log2 (elts * 4);
+          nsize = (size_t) 1 << nlog2;
+        }
+      else
+        {
+          nindex = higher_prime_index (elts * 2);
+          nsize = prime_tab[nindex].prime;
+        }
     }
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   else
     {
       nindex = oindex;
@@ -527,6 +675,9 @@ htab_expand (htab_t htab)
   htab->entries = nentries;
   htab->size = nsize;
   htab->size_prime_index = nindex;
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  htab->size_log2 = nlog2;
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   htab->n_elements -= htab->n_deleted;
   htab->n_deleted = 0;
 
@@ -537,7 +688,12 @@ htab_expand (htab_t htab)
 
       if (x != HTAB_EMPTY_ENTRY && x != HTAB_DELETED_ENTRY)
         {
-          PTR *q = find_empty_slot_for_expand (htab, (*htab->hash_f) (x));
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+          PTR *q = find_empty_slot_for_expand (htab,
+                                               htab->pointer_keys
+                                               ? hash_pointer (x)
+                                               : (*htab->hash_f) (x));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 
           *q = x;
         }
@@ -563,6 +719,11 @@ htab_find_with_hash (htab_t htab, const PTR element, hashval_t hash)
   size_t size;
   PTR entry;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (htab->size_log2)
+    return htab_find_with_hash_pow2 (htab, element, hash);
+
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   htab->searches++;
   size = htab_size (htab);
   index = htab_mod (hash, htab);
@@ -593,6 +754,10 @@ htab_find_with_hash (htab_t htab, const PTR element, hashval_t hash)
 PTR
 htab_find (htab_t htab, const PTR element)
 {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (htab->pointer_keys)
+    return htab_find_with_hash_pow2 (htab, element, hash_pointer (element));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   return htab_find_with_hash (htab, element, (*htab->hash_f) (element));
 }
 
@@ -613,6 +778,11 @@ htab_find_slot_with_hash (htab_t htab, const PTR element,
   size_t size;
   PTR entry;
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (htab->size_log2)
+    return htab_find_slot_with_hash_pow2 (htab, element, hash, insert);
+
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   size = htab_size (htab);
   if (insert == INSERT && size * 3 <= htab->n_elements * 4)
     {
@@ -675,10 +845,102 @@ htab_find_slot_with_hash (htab_t htab, const PTR element,
 PTR *
 htab_find_slot (htab_t htab, const PTR element, enum insert_option insert)
 {
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  if (htab->pointer_keys)
+    return htab_find_slot_with_hash_pow2 (htab, element,
+                                          hash_pointer (element), insert);
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
   return htab_find_slot_with_hash (htab, element, (*htab->hash_f) (element),
                                    insert);
 }
 
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+/* htab_find_with_hash for power-of-two tables.  */
+
+static PTR
+htab_find_with_hash_pow2 (htab_t htab, const PTR element, hashval_t hash)
+{
+  size_t mask = htab_size (htab) - 1;
+  hashval_t index = htab_pow2_index (hash, htab);
+  PTR entry;
+
+  htab->searches++;
+
+  if (htab->pointer_keys)
+    for (;;)
+      {
+        entry = htab->entries[index];
+        if (entry == element || entry == HTAB_EMPTY_ENTRY)
+          return entry;
+        htab->collisions++;
+        index = (index + 1) & mask;
+      }
+
+  for (;;)
+    {
+      entry = htab->entries[index];
+      if (entry == HTAB_EMPTY_ENTRY
+          || (entry != HTAB_DELETED_ENTRY && (*htab->eq_f) (entry, element)))
+        return entry;
+      htab->collisions++;
+      index = (index + 1) & mask;
+    }
+}
+
+/* htab_find_slot_with_hash for power-of-two tables.  */
+
+static PTR *
+htab_find_slot_with_hash_pow2 (htab_t htab, const PTR element,
+                               hashval_t hash, enum insert_option insert)
+{
+  PTR *first_deleted_slot = NULL;
+  size_t mask;
+  hashval_t index;
+  PTR entry;
+
+  if (insert == INSERT && htab_size (htab) <= htab->n_elements * 2)
+    {
+      if (htab_expand (htab) == 0)
+        return NULL;
+    }
+
+  mask = htab_size (htab) - 1;
+  index = htab_pow2_index (hash, htab);
+  htab->searches++;
+
+  for (;;)
+    {
+      entry = htab->entries[index];
+      if (entry == HTAB_EMPTY_ENTRY)
+        break;
+      else if (entry == HTAB_DELETED_ENTRY)
+        {
+          if (!first_deleted_slot)
+            first_deleted_slot = &htab->entries[index];
+        }
+      else if (htab->pointer_keys
+               ? entry == element
+               : (*htab->eq_f) (entry, element))
+        return &htab->entries[index];
+      htab->collisions++;
+      index = (index + 1) & mask;
+    }
+
+  if (insert == NO_INSERT)
+    return NULL;
+
+  if (first_deleted_slot)
+    {
+      htab->n_deleted--;
+      *first_deleted_slot = HTAB_EMPTY_ENTRY;
+      return first_deleted_slot;
+    }
+
+  htab->n_elements++;
+  return &htab->entries[index];
+}
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
+
 /* This function deletes an element with the given value from hash
    table (the hash is computed from the element).  If there is no matching
    element in the hash table, this function does nothing.  */
@@ -686,7 +948,12 @@ htab_find_slot (htab_t htab, const PTR element, enum insert_option insert)
 void
 htab_remove_elt (htab_t htab, PTR element)
 {
-  htab_remove_elt_with_hash (htab, element, (*htab->hash_f) (element));
+/* BEGIN GCC-XML MODIFICATIONS 2026-10-18 */
+  htab_remove_elt_with_hash (htab, element,
+                             htab->pointer_keys
+                             ? hash_pointer (element)
+                             : (*htab->hash_f) (element));
+/* END GCC-XML MODIFICATIONS 2026-10-18 */
 }
 
 
@@ -0,0 +1,275 @@
+/* hashtab test program and benchmark.
+   Copyright (C) 2026 Free Software Foundation, Inc.
+
+   This file is part of the libiberty library, which is part of GCC.
+
+   This file is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   In addition to the permissions in the GNU General Public License, the
+   Free Software Foundation gives you unlimited permission to link the
+   compiled version of this file into combinations with other programs,
+   and to distribute those combinations without any restriction coming
+   from the use of this file.  (The General Public License restrictions
+   do apply in other respects; for example, they cover modification of
+   the file, and distribution when not linked into a combined
+   executable.)
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/* Without arguments this checks that tables made by htab_create and
+   htab_create_pow2 behave the same through insertion, lookup,
+   removal, expansion and traversal, for both pointer and string keys.
+
+   With "-b [N]..." it instead times pointer-key tables of each kind:
+   N keys are inserted in random order and then 2N lookups are made,
+   half of which miss.  Each N is repeated until about 20 million keys
+   have been inserted, so the totals are comparable across sizes.  */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include "libiberty.h"
+#include "hashtab.h"
+#include <stdio.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifndef EXIT_SUCCESS
+#define EXIT_SUCCESS 0
+#endif
+
+#ifndef EXIT_FAILURE
+#define EXIT_FAILURE 1
+#endif
+
+/* Number of keys used by the functional checks.  Large enough to
+   force several expansions from the initial size.  */
+#define CHECK_KEYS 5000
+
+/* Total insertions per table kind in benchmark mode.  */
+#define BENCH_TOTAL 20000000
+
+static int failures;
+
+#define CHECK(COND) \
+  do { if (!(COND)) check_failed (__LINE__, #COND, kind); } while (0)
+
+static void
+check_failed (int line, const char *cond, const char *kind)
+{
+  fprintf (stderr, "test-hashtab:%d: %s table: %s\n", line, kind, cond);
+  failures++;
+}
+
+static htab_t
+make_table (int pow2, htab_hash hash, htab_eq eq)
+{
+  if (pow2)
+    return htab_create_pow2 (7, hash, eq, NULL);
+  return htab_create (7, hash, eq, NULL);
+}
+
+static int
+count_entry (void **slot ATTRIBUTE_UNUSED, void *data)
+{
+  ++*(size_t *) data;
+  return 1;
+}
+
+/* Shuffle the N elements of PERM with a fixed seed, so every run
+   probes in the same order.  */
+
+static void
+shuffle (int *perm, int n)
+{
+  int i;
+
+  srand (1);
+  for (i = 0; i < n; i++)
+    perm[i] = i;
+  for (i = n - 1; i > 0; i--)
+    {
+      int j = rand () % (i + 1);
+      int t = perm[i];
+      perm[i] = perm[j];
+      perm[j] = t;
+    }
+}
+
+static void
+check_pointer_keys (int pow2)
+{
+  const char *kind = pow2 ? "pow2" : "prime";
+  char *objs = XNEWVEC (char, 2 * CHECK_KEYS);
+  htab_t h = make_table (pow2, htab_hash_pointer, htab_eq_pointer);
+  size_t n;
+  int i;
+
+  for (i = 0; i < CHECK_KEYS; i++)
+    {
+      void **slot = htab_find_slot (h, objs + 2 * i, INSERT);
+      CHECK (*slot == NULL);
+      *slot = objs + 2 * i;
+    }
+  CHECK (htab_elements (h) == CHECK_KEYS);
+  CHECK (htab_size (h) > CHECK_KEYS);
+
+  /* Re-inserting finds the existing slot.  */
+  for (i = 0; i < CHECK_KEYS; i++)
+    CHECK (*htab_find_slot (h, objs + 2 * i, INSERT) == objs + 2 * i);
+  CHECK (htab_elements (h) == CHECK_KEYS);
+
+  for (i = 0; i < CHECK_KEYS; i++)
+    {
+      CHECK (htab_find (h, objs + 2 * i) == objs + 2 * i);
+      CHECK (htab_find (h, objs + 2 * i + 1) == NULL);
+      CHECK (htab_find_slot (h, objs + 2 * i + 1, NO_INSERT) == NULL);
+    }
+
+  /* Remove every other key; the survivors must still be reachable
+     past the deleted entries.  */
+  for (i = 0; i < CHECK_KEYS; i += 2)
+    htab_remove_elt (h, objs + 2 * i);
+  CHECK (htab_elements (h) == CHECK_KEYS / 2);
+  for (i = 0; i < CHECK_KEYS; i++)
+    CHECK ((htab_find (h, objs + 2 * i) != NULL) == (i % 2 == 1));
+
+  n = 0;
+  htab_traverse (h, count_entry, &n);
+  CHECK (n == CHECK_KEYS / 2);
+
+  /* Reinsert into the deleted entries.  */
+  for (i = 0; i < CHECK_KEYS; i += 2)
+    *htab_find_slot (h, objs + 2 * i, INSERT) = objs + 2 * i;
+  CHECK (htab_elements (h) == CHECK_KEYS);
+  for (i = 0; i < CHECK_KEYS; i++)
+    CHECK (htab_find (h, objs + 2 * i) == objs + 2 * i);
+
+  htab_empty (h);
+  CHECK (htab_elements (h) == 0);
+  for (i = 0; i < CHECK_KEYS; i++)
+    CHECK (htab_find (h, objs + 2 * i) == NULL);
+
+  htab_delete (h);
+  free (objs);
+}
+
+static int
+eq_string (const void *a, const void *b)
+{
+  return strcmp ((const char *) a, (const char *) b) == 0;
+}
+
+static void
+check_string_keys (int pow2)
+{
+  const char *kind = pow2 ? "pow2" : "prime";
+  char (*keys)[16] = (char (*)[16]) xmalloc (CHECK_KEYS * 16);
+  htab_t h = make_table (pow2, htab_hash_string, eq_string);
+  char probe[16];
+  int i;
+
+  for (i = 0; i < CHECK_KEYS; i++)
+    {
+      sprintf (keys[i], "key%d", i);
+      *htab_find_slot (h, keys[i], INSERT) = keys[i];
+    }
+  CHECK (htab_elements (h) == CHECK_KEYS);
+
+  /* Lookups go through eq_f with a different pointer to equal text.  */
+  for (i = 0; i < CHECK_KEYS; i++)
+    {
+      sprintf (probe, "key%d", i);
+      CHECK (htab_find (h, probe) == keys[i]);
+      sprintf (probe, "miss%d", i);
+      CHECK (htab_find (h, probe) == NULL);
+    }
+
+  htab_delete (h);
+  free (keys);
+}
+
+static void
+bench (int n)
+{
+  int rounds = BENCH_TOTAL / n > 0 ? BENCH_TOTAL / n : 1;
+  char *objs = XNEWVEC (char, (size_t) n * 64);
+  int *perm = XNEWVEC (int, n);
+  int *perm2 = XNEWVEC (int, 2 * n);
+  int pow2;
+
+  shuffle (perm, n);
+  shuffle (perm2, 2 * n);
+  for (pow2 = 0; pow2 < 2; pow2++)
+    {
+      long t_insert = 0, t_find = 0;
+      size_t found = 0;
+      int r, i;
+
+      for (r = 0; r < rounds; r++)
+        {
+          htab_t h = make_table (pow2, htab_hash_pointer, htab_eq_pointer);
+          long t0 = get_run_time (), t1;
+
+          for (i = 0; i < n; i++)
+            *htab_find_slot (h, objs + 64 * (size_t) perm[i], INSERT)
+              = objs + 64 * (size_t) perm[i];
+          t1 = get_run_time ();
+          for (i = 0; i < 2 * n; i++)
+            found += htab_find (h, objs + 32 * (size_t) perm2[i]) != NULL;
+          t_find += get_run_time () - t1;
+          t_insert += t1 - t0;
+          htab_delete (h);
+        }
+      printf ("%-5s N=%-8d insert %6.2fs  find %6.2fs  (%lu found)\n",
+              pow2 ? "pow2" : "prime", n, t_insert / 1e6, t_find / 1e6,
+              (unsigned long) found);
+    }
+
+  free (perm2);
+  free (perm);
+  free (objs);
+}
+
+int
+main (int argc, char **argv)
+{
+  if (argc > 1 && strcmp (argv[1], "-b") == 0)
+    {
+      int i;
+
+      if (argc == 2)
+        {
+          bench (1000);
+          bench (100000);
+          bench (1000000);
+        }
+      for (i = 2; i < argc; i++)
+        bench (atoi (argv[i]));
+      return EXIT_SUCCESS;
+    }
+
+  check_pointer_keys (0);
+  check_pointer_keys (1);
+  check_string_keys (0);
+  check_string_keys (1);
+
+  if (failures)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/*=========================================================================
+
+  Program:   GCC-XML
+  Module:    $RCSfile: gccxml_session.h,v $
+  Language:  C
+  Date:      $Date$
+  Version:   $Revision$
+
+  Copyright (c) 2002 Kitware, Inc., Insight Consortium.  All rights reserved.
+  See Copyright.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notices for more information.
+
+=========================================================================*/
+/* C interface of the gccxml library, for programs that parse many
+   sources and do not want to run the gccxml front end for each.
+
+   A session does the work the gccxml executable does before it runs
+   gccxml_cc1plus -- reading the configuration and finding the flags
+   of the compiler being simulated -- once, when it is created.  Every
+   parse then runs gccxml_cc1plus directly with the cached command
+   line.  The source and any header overrides go to its standard
+   input, which it reads with -fvirtual-files=-, and the XML comes
+   back on its standard output, so a parse writes no files.
+
+   When it is created a session also has gccxml_cc1plus write a
+   startup image to a temporary file: the state it reaches after
+   initializing and reading the -include files of the configuration.
+   Each parse restores that state instead of building it again, unless
+   its headers replace one of the -include files.  The file is removed
+   when the session is destroyed.
+
+   The library is not thread-safe.  */
+
+#ifndef GCCXML_SESSION_H
+#define GCCXML_SESSION_H
+
+#include "gccxml_plugin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct gccxml_session gccxml_session;
+
+/* A source file held in memory.  */
+typedef struct gccxml_file
+{
+  /* The path the parser sees for the file.  For a header this must be
+     spelled the way the parser forms it from an #include directive:
+     the directory of the including file or an include directory, a
+     slash, and the name in the directive.  Paths are compared after
+     "." and ".." components are removed.  The directories holding
+     the files need not exist on disk and may be named with -I when
+     the session is created.  */
+  const char* path;
+
+  const char* data;
+  size_t length;
+} gccxml_file;
+
+/* Create a session.  ARGV holds what would be given to the gccxml
+   executable, without an input file: ARGV[0] must name the gccxml
+   executable, which is used to find the configuration and
+   gccxml_cc1plus as it would be when running it; the other
+   arguments are options such as -I, -D and --gccxml-compiler.
+   Return NULL if the configuration fails, after reporting why on the
+   standard error.  */
+gccxml_session* gccxml_session_create(int argc, const char* const* argv);
+
+/* Parse SOURCE.  Each of the NUM_HEADERS entries of HEADERS replaces
+   the file of the same path, or provides it if it does not exist.
+   Return zero on success, in which case gccxml_session_output gives
+   the XML.  On failure gccxml_session_diagnostics says why.  */
+int gccxml_session_parse(gccxml_session* session,
+                         const gccxml_file* source,
+                         const gccxml_file* headers,
+                         unsigned int num_headers);
+
+/* Get the XML produced by the last successful parse.  The text is
+   owned by the session and valid until the next parse.  */
+const char* gccxml_session_output(gccxml_session* session, size_t* length);
+
+/* Get the diagnostics the last parse produced, if any.  */
+const char* gccxml_session_diagnostics(gccxml_session* session);
+
+/* Pass the elements of the last successful parse to the callbacks of
+   CONSUMER, exactly as gccxml_cc1plus passes them to a -fxml-plugin
+   library, and then call its finish callback.  Return zero on
+   success, or nonzero if the output could not be read.  */
+int gccxml_session_stream(gccxml_session* session,
+                          const gccxml_plugin* consumer);
+
+/* Free the session and everything it owns.  */
+void gccxml_session_destroy(gccxml_session* session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -95,7 +95,8 @@ const gxDocumentationEntry gxDocumentationOptions[] =
    "This is useful when attempting to simulate an unsupported compiler."},
   {"-fxml=<output-file>", "Specify the XML output file.",
    "This option is passed directly on to the patched GCC C++ parser.  It "
-   "enables the XML dump and specifies the output file name."},
+   "enables the XML dump and specifies the output file name.  A name of "
+   "\"-\" writes the dump to the standard output."},
   {"-fxml-start=<xxx>[,...]", "Specify a list of starting declarations.",
    "This option is passed directly on to the patched GCC C++ parser.  It "
    "is meaningful only if -fxml= is also specified.  This specifies a "
@@ -103,6 +104,55 @@ const gxDocumentationEntry gxDocumentationOptions[] =
    "dump only the subset of the declarations in the translation unit that "
    "is reachable through a sequence of source references from one of the "
    "specified starting declarations."},
+  {"-fxml-plugin=<library>", "Pass the dump to a plugin library.",
+   "This option is passed directly on to the patched GCC C++ parser.  It "
+   "loads the given shared library after parsing and passes it every "
+   "element of the dump through the C interface declared in "
+   "gccxml_plugin.h, without formatting any XML text.  It may be combined "
+   "with -fxml= to write the XML file as well."},
+  {"-fxml-plugin-arg=<xxx>", "Pass a string to the plugin library.",
+   "This option is passed directly on to the patched GCC C++ parser.  The "
+   "string is given to the init function of the -fxml-plugin= library."},
+  {"-fvirtual-files=<file>", "Read source files from a single file.",
+   "This option is passed directly on to the patched GCC C++ parser.  The "
+   "file, or the standard input if it is \"-\", holds a sequence of "
+   "entries, each a line with the size in bytes of a source file, a space "
+   "and its path, followed by the contents.  Whenever the parser looks for "
+   "one of these paths, including the input file, it uses the given "
+   "contents instead of reading the file system.  Paths are compared after "
+   "removing \".\" and \"..\" components, and the directories containing "
+   "them exist for the parser even if they do not exist on disk, so they "
+   "may be given with -I.  The option may be repeated; a later entry for "
+   "the same path replaces an earlier one.  The gccxml library passes "
+   "sources held in memory this way."},
+  {"-flazy-template-members", "Instantiate member functions on first use.",
+   "This option is passed directly on to the patched GCC C++ parser.  The "
+   "non-virtual member functions of an implicitly instantiated class "
+   "template are declared only when their name is looked up, or when the "
+   "class is written to the XML file.  This saves time and memory when "
+   "-fxml-start= limits the dump and many instantiations are used only "
+   "for a few members.  The declarations of members that are never used "
+   "are not checked, so an ill-formed one is not diagnosed, and the _N "
+   "ids of the elements may be numbered differently."},
+  {"-ftemplate-report", "Report what each template costs to instantiate.",
+   "This option is passed directly on to the patched GCC C++ parser.  At "
+   "exit it prints a table of the templates whose instantiations took the "
+   "most time.  For each template it gives the number of classes and of "
+   "functions or static data members instantiated from it, and the time "
+   "and garbage-collected memory spent on them, both including and "
+   "excluding the instantiations of other templates they caused."},
+  {"-ftemplate-report-file=<file>", "Write the template report to a file.",
+   "This option is passed directly on to the patched GCC C++ parser.  It "
+   "writes the figures of -ftemplate-report for every instantiated "
+   "template to the file as tab-separated values, one line per template "
+   "after a header line starting with \"#\".  Given alone, it prints "
+   "nothing to the terminal."},
+  {"-falloc-report", "Report where garbage-collected memory is allocated.",
+   "This option is passed directly on to the patched GCC C++ parser.  At "
+   "exit it prints the source files the parser was reading when the most "
+   "garbage-collected memory was allocated, and the tree codes whose nodes "
+   "took the most memory, with the bytes and number of objects of each.  "
+   "Counting costs a few percent of the run time."},
   {"--gccxml-compiler <xxx>", "Set GCCXML_COMPILER to \"xxx\".", 0},
   {"--gccxml-cxxflags <xxx>", "Set GCCXML_CXXFLAGS to \"xxx\".", 0},
   {"--gccxml-executable <xxx>", "Set GCCXML_EXECUTABLE to \"xxx\".", 0},
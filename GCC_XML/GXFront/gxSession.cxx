@@ -0,0 +1,764 @@
+/*=========================================================================
+
+  Program:   GCC-XML
+  Module:    $RCSfile: gxSession.cxx,v $
+  Language:  C++
+  Date:      $Date$
+  Version:   $Revision$
+
+  Copyright (c) 2002 Kitware, Inc., Insight Consortium.  All rights reserved.
+  See Copyright.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notices for more information.
+
+=========================================================================*/
+#include "gccxml_session.h"
+#include "gxConfiguration.h"
+#include "gxFlagsParser.h"
+
+#include <gxsys/Process.h>
+#include <gxsys/ios/sstream>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+# include <windows.h>
+#else
+# include <errno.h>
+# include <fcntl.h>
+# include <poll.h>
+# include <signal.h>
+# include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+struct gccxml_session
+{
+  // The gccxml_cc1plus executable and the arguments gxFront would
+  // give it, without the input file.
+  std::string m_Executable;
+  std::vector<std::string> m_Flags;
+
+  // The startup image written when the session was created, or empty
+  // if it could not be written.
+  std::string m_StartupImage;
+
+  // Results of the last parse.
+  std::string m_Output;
+  std::string m_Diagnostics;
+};
+
+//----------------------------------------------------------------------------
+static void gxSessionAddFile(std::string& bundle, const gccxml_file& file)
+{
+  gxsys_ios::ostringstream header;
+  header << static_cast<unsigned long>(file.length) << " " << file.path
+         << "\n";
+  bundle += header.str();
+  bundle.append(file.data, file.length);
+}
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+//----------------------------------------------------------------------------
+// Writes a bundle to the standard input of gccxml_cc1plus.  Windows
+// anonymous pipes cannot be written without blocking, so this is done
+// from a thread while the output is read.
+struct gxSessionFeeder
+{
+  HANDLE m_Pipe;
+  const char* m_Data;
+  size_t m_Length;
+};
+
+//----------------------------------------------------------------------------
+static DWORD WINAPI gxSessionFeed(LPVOID arg)
+{
+  gxSessionFeeder* feeder = static_cast<gxSessionFeeder*>(arg);
+  while(feeder->m_Length > 0)
+    {
+    DWORD chunk = feeder->m_Length > 65536? 65536 :
+      static_cast<DWORD>(feeder->m_Length);
+    DWORD written;
+    if(!WriteFile(feeder->m_Pipe, feeder->m_Data, chunk, &written, 0))
+      {
+      // The parser has exited.
+      break;
+      }
+    feeder->m_Data += written;
+    feeder->m_Length -= written;
+    }
+  CloseHandle(feeder->m_Pipe);
+  return 0;
+}
+#else
+//----------------------------------------------------------------------------
+// Write as much of [DATA, END) as the non-blocking pipe FD takes and
+// advance DATA past it.  Return false if the reader has exited.
+static bool gxSessionFeed(int fd, const char*& data, const char* end)
+{
+  // Writing to a pipe whose reader has exited raises SIGPIPE.  Keep it
+  // blocked during the write and take it if the write raised it, so
+  // the signal handling of the process is not changed.
+  sigset_t pipeSet;
+  sigset_t oldSet;
+  sigset_t pending;
+  sigemptyset(&pipeSet);
+  sigaddset(&pipeSet, SIGPIPE);
+  sigprocmask(SIG_BLOCK, &pipeSet, &oldSet);
+  sigpending(&pending);
+  bool wasPending = sigismember(&pending, SIGPIPE) == 1;
+
+  bool reading = true;
+  while(data < end)
+    {
+    ssize_t n = write(fd, data, end - data);
+    if(n > 0)
+      {
+      data += n;
+      }
+    else if(n < 0 && errno == EINTR)
+      {
+      continue;
+      }
+    else
+      {
+      if(n < 0 && errno == EPIPE)
+        {
+        reading = false;
+        if(!wasPending)
+          {
+          int signal;
+          sigwait(&pipeSet, &signal);
+          }
+        }
+      else if(n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+        {
+        reading = false;
+        }
+      break;
+      }
+    }
+
+  sigprocmask(SIG_SETMASK, &oldSet, 0);
+  return reading;
+}
+#endif
+
+//----------------------------------------------------------------------------
+// Run gccxml_cc1plus with ARGS and give it BUNDLE on its standard
+// input, which its -fvirtual-files=- option reads.  Its standard
+// output goes to the session output and its standard error to the
+// session diagnostics.  Return its exit value, or nonzero if it could
+// not be run.
+static int gxSessionRun(gccxml_session* session,
+                        std::vector<const char*>& args,
+                        const std::string& bundle)
+{
+  session->m_Output.clear();
+  session->m_Diagnostics.clear();
+
+  // The bundle is written while the output is read, since the parser
+  // might fill either pipe before it is done with the other.
+  const char* next = bundle.data();
+  const char* end = next + bundle.size();
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  HANDLE input[2];
+  if(!CreatePipe(&input[0], &input[1], 0, 0))
+    {
+    session->m_Diagnostics = "Could not create a pipe.\n";
+    return 1;
+    }
+#else
+  int input[2];
+  if(pipe(input) < 0)
+    {
+    session->m_Diagnostics = "Could not create a pipe.\n";
+    return 1;
+    }
+  fcntl(input[1], F_SETFL, fcntl(input[1], F_GETFL) | O_NONBLOCK);
+#endif
+
+  // Run the patched GCC C++ parser.  Executing it closes the read end
+  // of the input pipe here.
+  gxsysProcess* gp = gxsysProcess_New();
+  gxsysProcess_SetCommand(gp, &*args.begin());
+  gxsysProcess_SetPipeNative(gp, gxsysProcess_Pipe_STDIN, input);
+  gxsysProcess_Execute(gp);
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  gxSessionFeeder feeder = {input[1], next, bundle.size()};
+  HANDLE feederThread = CreateThread(0, 0, gxSessionFeed, &feeder, 0, 0);
+  if(!feederThread)
+    {
+    CloseHandle(input[1]);
+    }
+#else
+  int feedFD = input[1];
+  bool timedOut = false;
+#endif
+
+  char* data;
+  int length;
+  int pipeId;
+  for(;;)
+    {
+    double timeout = 0;
+    double* userTimeout = 0;
+#if !defined(_WIN32) || defined(__CYGWIN__)
+    if(feedFD >= 0)
+      {
+      if(!gxSessionFeed(feedFD, next, end) || next == end)
+        {
+        close(feedFD);
+        feedFD = -1;
+        }
+      else
+        {
+        // The pipe is full.  Wait a little for the parser to take
+        // more, unless it may have output waiting, and then look for
+        // output without waiting.
+        if(timedOut)
+          {
+          struct pollfd writable;
+          writable.fd = feedFD;
+          writable.events = POLLOUT;
+          poll(&writable, 1, 10);
+          }
+        userTimeout = &timeout;
+        }
+      }
+#endif
+    pipeId = gxsysProcess_WaitForData(gp, &data, &length, userTimeout);
+#if !defined(_WIN32) || defined(__CYGWIN__)
+    timedOut = pipeId == gxsysProcess_Pipe_Timeout;
+    if(timedOut)
+      {
+      continue;
+      }
+#endif
+    if(pipeId == gxsysProcess_Pipe_None)
+      {
+      break;
+      }
+    if(pipeId == gxsysProcess_Pipe_STDOUT)
+      {
+      session->m_Output.append(data, length);
+      }
+    else if(pipeId == gxsysProcess_Pipe_STDERR)
+      {
+      session->m_Diagnostics.append(data, length);
+      }
+    }
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  if(feederThread)
+    {
+    WaitForSingleObject(feederThread, INFINITE);
+    CloseHandle(feederThread);
+    }
+#else
+  if(feedFD >= 0)
+    {
+    close(feedFD);
+    }
+#endif
+  gxsysProcess_WaitForExit(gp, 0);
+
+  int result = 1;
+  switch(gxsysProcess_GetState(gp))
+    {
+    case gxsysProcess_State_Exited:
+      {
+      result = gxsysProcess_GetExitValue(gp);
+      } break;
+    case gxsysProcess_State_Error:
+      {
+      session->m_Diagnostics += "Error: Could not run ";
+      session->m_Diagnostics += session->m_Executable;
+      session->m_Diagnostics += ":\n";
+      session->m_Diagnostics += gxsysProcess_GetErrorString(gp);
+      session->m_Diagnostics += "\n";
+      } break;
+    case gxsysProcess_State_Exception:
+      {
+      session->m_Diagnostics += "Error: ";
+      session->m_Diagnostics += session->m_Executable;
+      session->m_Diagnostics += " terminated with an exception: ";
+      session->m_Diagnostics += gxsysProcess_GetExceptionString(gp);
+      session->m_Diagnostics += "\n";
+      } break;
+    default:
+      {
+      // Should not get here.
+      session->m_Diagnostics += "Unexpected ending state after running ";
+      session->m_Diagnostics += session->m_Executable;
+      session->m_Diagnostics += "\n";
+      } break;
+    }
+  gxsysProcess_Delete(gp);
+
+  if(result != 0)
+    {
+    session->m_Output.clear();
+    }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Add the arguments every run of gccxml_cc1plus gets to ARGS.
+static void gxSessionAddArguments(gccxml_session* session,
+                                  std::vector<const char*>& args)
+{
+  args.push_back(session->m_Executable.c_str());
+  for(std::vector<std::string>::const_iterator i = session->m_Flags.begin();
+      i != session->m_Flags.end(); ++i)
+    {
+    args.push_back(i->c_str());
+    }
+  args.push_back("-fvirtual-files=-");
+}
+
+//----------------------------------------------------------------------------
+// Create an empty temporary file whose name starts with PREFIX and
+// store its name in NAME.  Return false if there is no place for it.
+static bool gxSessionCreateTempFile(std::string& name, const char* prefix)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  char dir[MAX_PATH];
+  char path[MAX_PATH];
+  if(GetTempPathA(MAX_PATH, dir) == 0 ||
+     GetTempFileNameA(dir, prefix, 0, path) == 0)
+    {
+    return false;
+    }
+  name = path;
+#else
+  const char* dir = getenv("TMPDIR");
+  std::string path = dir && *dir? dir : "/tmp";
+  path += "/";
+  path += prefix;
+  path += "_XXXXXX";
+  std::vector<char> buffer(path.begin(), path.end());
+  buffer.push_back(0);
+  int fd = mkstemp(&*buffer.begin());
+  if(fd < 0)
+    {
+    return false;
+    }
+  close(fd);
+  name = &*buffer.begin();
+#endif
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Write the state of gccxml_cc1plus after it has initialized and read
+// the -include files of the configuration, so that each parse can
+// restore it instead of building it again.  Parses run without the
+// image if this fails.
+static void gxSessionWriteStartupImage(gccxml_session* session)
+{
+  if(!gxSessionCreateTempFile(session->m_StartupImage, "gccxml_startup"))
+    {
+    session->m_StartupImage = "";
+    return;
+    }
+
+  std::string option = "-fstartup-image-output=";
+  option += session->m_StartupImage;
+  std::vector<const char*> args;
+  gxSessionAddArguments(session, args);
+  args.push_back(option.c_str());
+  args.push_back("gccxml_startup_image.cxx");
+  args.push_back(0);
+
+  gccxml_file empty = {"gccxml_startup_image.cxx", "", 0};
+  std::string bundle;
+  gxSessionAddFile(bundle, empty);
+  if(gxSessionRun(session, args, bundle) != 0)
+    {
+    remove(session->m_StartupImage.c_str());
+    session->m_StartupImage = "";
+    }
+  session->m_Output.clear();
+  session->m_Diagnostics.clear();
+}
+
+//----------------------------------------------------------------------------
+gccxml_session* gccxml_session_create(int argc, const char* const* argv)
+{
+  gxConfiguration configuration;
+  if(!configuration.Configure(argc, argv) || !configuration.ConfigureFlags())
+    {
+    return 0;
+    }
+  if(configuration.GetGCCXML_EXECUTABLE().empty())
+    {
+    std::cerr << "Could not determine GCCXML_EXECUTABLE setting.\n";
+    return 0;
+    }
+
+  // Build the command line the same way gxFront does.
+  gxFlagsParser parser;
+  parser.Parse(configuration.GetGCCXML_FLAGS().c_str());
+  parser.Parse(configuration.GetGCCXML_USER_FLAGS().c_str());
+
+  gccxml_session* session = new gccxml_session;
+  session->m_Executable = configuration.GetGCCXML_EXECUTABLE();
+  configuration.AddArguments(session->m_Flags);
+  parser.AddParsedFlags(session->m_Flags);
+  gxSessionWriteStartupImage(session);
+  return session;
+}
+
+//----------------------------------------------------------------------------
+int gccxml_session_parse(gccxml_session* session,
+                         const gccxml_file* source,
+                         const gccxml_file* headers,
+                         unsigned int num_headers)
+{
+  // Everything the parser reads from memory goes into one bundle on
+  // its standard input.
+  std::string bundle;
+  for(unsigned int i=0; i < num_headers; ++i)
+    {
+    gxSessionAddFile(bundle, headers[i]);
+    }
+  gxSessionAddFile(bundle, *source);
+
+  // gccxml_cc1plus checks that the image fits this parse and builds
+  // the state itself if it does not.
+  std::string image;
+  std::vector<const char*> args;
+  gxSessionAddArguments(session, args);
+  if(!session->m_StartupImage.empty())
+    {
+    image = "-fstartup-image=";
+    image += session->m_StartupImage;
+    args.push_back(image.c_str());
+    }
+  args.push_back("-fxml=-");
+  args.push_back(source->path);
+  args.push_back(0);
+
+  return gxSessionRun(session, args, bundle);
+}
+
+//----------------------------------------------------------------------------
+const char* gccxml_session_output(gccxml_session* session, size_t* length)
+{
+  if(length)
+    {
+    *length = session->m_Output.size();
+    }
+  return session->m_Output.c_str();
+}
+
+//----------------------------------------------------------------------------
+const char* gccxml_session_diagnostics(gccxml_session* session)
+{
+  return session->m_Diagnostics.c_str();
+}
+
+//----------------------------------------------------------------------------
+// The kinds of the attributes whose values are element identifiers.
+// This must match the kinds gccxml_cc1plus gives a plugin.
+static gccxml_value_kind gxSessionValueKind(const char* name, size_t length)
+{
+  static const struct { const char* Name; gccxml_value_kind Kind; }
+  kinds[] =
+    {
+      {"id", gccxml_value_id},
+      {"basetype", gccxml_value_idref},
+      {"context", gccxml_value_idref},
+      {"file", gccxml_value_idref},
+      {"namespace", gccxml_value_idref},
+      {"returns", gccxml_value_idref},
+      {"type", gccxml_value_idref},
+      {"bases", gccxml_value_idrefs},
+      {"befriending", gccxml_value_idrefs},
+      {"members", gccxml_value_idrefs},
+      {"overrides", gccxml_value_idrefs},
+      {"throw", gccxml_value_idrefs}
+    };
+  for(unsigned int i=0; i < sizeof(kinds)/sizeof(kinds[0]); ++i)
+    {
+    if(strlen(kinds[i].Name) == length &&
+       strncmp(kinds[i].Name, name, length) == 0)
+      {
+      return kinds[i].Kind;
+      }
+    }
+  return gccxml_value_string;
+}
+
+//----------------------------------------------------------------------------
+// Replace the XML character references in [VALUE, VALUE+LENGTH) and
+// append the result to OUT.
+static void gxSessionDecode(std::string& out, const char* value,
+                            size_t length)
+{
+  static const struct { const char* Text; size_t Length; char C; }
+  entities[] = {{"&amp;", 5, '&'}, {"&lt;", 4, '<'}, {"&gt;", 4, '>'},
+                {"&apos;", 6, '\''}, {"&quot;", 6, '"'}};
+  const char* end = value + length;
+  while(value < end)
+    {
+    if(*value == '&')
+      {
+      unsigned int i;
+      for(i=0; i < sizeof(entities)/sizeof(entities[0]); ++i)
+        {
+        if(static_cast<size_t>(end - value) >= entities[i].Length &&
+           strncmp(value, entities[i].Text, entities[i].Length) == 0)
+          {
+          break;
+          }
+        }
+      if(i < sizeof(entities)/sizeof(entities[0]))
+        {
+        out += entities[i].C;
+        value += entities[i].Length;
+        continue;
+        }
+      }
+    out += *value++;
+    }
+}
+
+//----------------------------------------------------------------------------
+// An open element while the output is streamed.  Values that needed
+// decoding live in m_Scratch, at the offsets in m_Decoded.
+struct gxSessionFrame
+{
+  gccxml_element m_Element;
+  std::vector<gccxml_attribute> m_Attributes;
+  std::vector<size_t> m_Decoded;
+  std::string m_Scratch;
+};
+
+//----------------------------------------------------------------------------
+static bool gxSessionStream(const char* in, const char* end,
+                            const gccxml_plugin* consumer,
+                            std::vector<gxSessionFrame*>& frames)
+{
+  static const size_t notDecoded = static_cast<size_t>(-1);
+  unsigned int depth = 0;
+  for(;;)
+    {
+    while(in < end && (*in == ' ' || *in == '\n' || *in == '\r'))
+      {
+      ++in;
+      }
+    if(in == end)
+      {
+      return depth == 0;
+      }
+    if(*in++ != '<' || in == end)
+      {
+      return false;
+      }
+
+    // Skip the XML declaration.
+    if(*in == '?')
+      {
+      while(in < end && *in != '>')
+        {
+        ++in;
+        }
+      if(in++ == end)
+        {
+        return false;
+        }
+      continue;
+      }
+
+    // End tag.
+    if(*in == '/')
+      {
+      while(in < end && *in != '>')
+        {
+        ++in;
+        }
+      if(in++ == end || depth == 0)
+        {
+        return false;
+        }
+      --depth;
+      if(consumer->end_element)
+        {
+        consumer->end_element(consumer->data, &frames[depth]->m_Element);
+        }
+      continue;
+      }
+
+    // Start tag.
+    if(depth == frames.size())
+      {
+      frames.push_back(new gxSessionFrame);
+      }
+    gxSessionFrame* frame = frames[depth];
+    gccxml_element& element = frame->m_Element;
+    frame->m_Attributes.clear();
+    frame->m_Decoded.clear();
+    frame->m_Scratch.clear();
+    element.kind.data = in;
+    while(in < end && *in != ' ' && *in != '/' && *in != '>')
+      {
+      ++in;
+      }
+    element.kind.length = in - element.kind.data;
+    element.id.data = "";
+    element.id.length = 0;
+    element.name.data = "";
+    element.name.length = 0;
+
+    bool empty = false;
+    for(;;)
+      {
+      while(in < end && *in == ' ')
+        {
+        ++in;
+        }
+      if(in == end)
+        {
+        return false;
+        }
+      if(*in == '>')
+        {
+        ++in;
+        break;
+        }
+      if(*in == '/')
+        {
+        if(++in == end || *in++ != '>')
+          {
+          return false;
+          }
+        empty = true;
+        break;
+        }
+
+      gccxml_attribute attribute;
+      attribute.name.data = in;
+      while(in < end && *in != '=')
+        {
+        ++in;
+        }
+      attribute.name.length = in - attribute.name.data;
+      if(in == end || ++in == end || *in++ != '"')
+        {
+        return false;
+        }
+      const char* value = in;
+      bool escaped = false;
+      while(in < end && *in != '"')
+        {
+        escaped = escaped || *in == '&';
+        ++in;
+        }
+      if(in == end)
+        {
+        return false;
+        }
+      if(escaped)
+        {
+        size_t offset = frame->m_Scratch.size();
+        gxSessionDecode(frame->m_Scratch, value, in - value);
+        frame->m_Decoded.push_back(offset);
+        attribute.value.data = 0;
+        attribute.value.length = frame->m_Scratch.size() - offset;
+        }
+      else
+        {
+        frame->m_Decoded.push_back(notDecoded);
+        attribute.value.data = value;
+        attribute.value.length = in - value;
+        }
+      ++in;
+      attribute.kind = gxSessionValueKind(attribute.name.data,
+                                          attribute.name.length);
+      frame->m_Attributes.push_back(attribute);
+      }
+
+    // The scratch space is complete, so decoded values can now point
+    // into it.
+    for(unsigned int i=0; i < frame->m_Attributes.size(); ++i)
+      {
+      gccxml_attribute& attribute = frame->m_Attributes[i];
+      if(frame->m_Decoded[i] != notDecoded)
+        {
+        attribute.value.data = frame->m_Scratch.data() + frame->m_Decoded[i];
+        }
+      if(attribute.kind == gccxml_value_id)
+        {
+        element.id = attribute.value;
+        }
+      else if(attribute.name.length == 4 &&
+              strncmp(attribute.name.data, "name", 4) == 0)
+        {
+        element.name = attribute.value;
+        }
+      }
+    element.attributes =
+      frame->m_Attributes.empty()? 0 : &*frame->m_Attributes.begin();
+    element.num_attributes =
+      static_cast<unsigned int>(frame->m_Attributes.size());
+    element.parent = depth? &frames[depth-1]->m_Element : 0;
+    element.depth = depth;
+
+    if(consumer->start_element)
+      {
+      consumer->start_element(consumer->data, &element);
+      }
+    if(empty)
+      {
+      if(consumer->end_element)
+        {
+        consumer->end_element(consumer->data, &element);
+        }
+      }
+    else
+      {
+      ++depth;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+int gccxml_session_stream(gccxml_session* session,
+                          const gccxml_plugin* consumer)
+{
+  if(session->m_Output.empty())
+    {
+    return 1;
+    }
+
+  const char* in = session->m_Output.data();
+  std::vector<gxSessionFrame*> frames;
+  bool result = gxSessionStream(in, in + session->m_Output.size(),
+                                consumer, frames);
+  for(std::vector<gxSessionFrame*>::iterator i = frames.begin();
+      i != frames.end(); ++i)
+    {
+    delete *i;
+    }
+  if(result && consumer->finish)
+    {
+    consumer->finish(consumer->data);
+    }
+  return result? 0 : 1;
+}
+
+//----------------------------------------------------------------------------
+void gccxml_session_destroy(gccxml_session* session)
+{
+  if(!session->m_StartupImage.empty())
+    {
+    remove(session->m_StartupImage.c_str());
+    }
+  delete session;
+}
@@ -0,0 +1,68 @@
+# Run gccxml_cc1plus on SOURCE and fail unless the dump contains every
+# text given in SOURCE on a line of the form
+#
+#   // XML: <text>
+#
+# The _N ids are ignored, so <text> names them all "_".  On a line of
+# the form
+#
+#   // XML names: <text>
+#
+# the ids of elements that have a demangled name are replaced by that
+# name instead, so <text> can tell which elements an attribute refers
+# to.
+#
+#   cmake -DCC1PLUS=<exe> -DSOURCE=<file> -DNAME=<name> [-DFLAGS=<flags>]
+#         -P CheckXML.cmake
+
+FOREACH(var CC1PLUS SOURCE NAME)
+  IF(NOT ${var})
+    MESSAGE(FATAL_ERROR "${var} is not set")
+  ENDIF(NOT ${var})
+ENDFOREACH(var)
+
+EXECUTE_PROCESS(
+  COMMAND ${CC1PLUS} -quiet ${SOURCE} -fxml=${NAME}.xml -o ${NAME}.s
+          ${FLAGS}
+  RESULT_VARIABLE result
+)
+IF(result)
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus failed: ${result}")
+ENDIF(result)
+FILE(READ ${NAME}.xml xml)
+SET(named "${xml}")
+STRING(REGEX REPLACE "_[0-9]+" "_" xml "${xml}")
+
+# Give each element with a demangled name that name in place of its id,
+# both where it is defined and where it is referred to.
+FILE(STRINGS ${NAME}.xml elements REGEX " id=\"_[0-9]+\" .* demangled=\"")
+FOREACH(element ${elements})
+  STRING(REGEX REPLACE "^.* id=\"(_[0-9]+)\".*$" "\\1" id "${element}")
+  STRING(REGEX REPLACE "^.* demangled=\"([^\"]*)\".*$" "\\1" demangled
+    "${element}")
+  STRING(REPLACE "\"${id}\"" "\"${demangled}\"" named "${named}")
+  STRING(REPLACE "\"${id} " "\"${demangled} " named "${named}")
+  STRING(REPLACE " ${id} " " ${demangled} " named "${named}")
+ENDFOREACH(element)
+STRING(REGEX REPLACE "_[0-9]+" "_" named "${named}")
+
+FILE(STRINGS ${SOURCE} expected REGEX "^// XML( names)?: ")
+IF(NOT expected)
+  MESSAGE(FATAL_ERROR "${SOURCE} expects nothing")
+ENDIF(NOT expected)
+SET(missing "")
+FOREACH(line ${expected})
+  IF("${line}" MATCHES "^// XML names: ")
+    STRING(REGEX REPLACE "^// XML names: " "" text "${line}")
+    STRING(FIND "${named}" "${text}" found)
+  ELSE("${line}" MATCHES "^// XML names: ")
+    STRING(REGEX REPLACE "^// XML: " "" text "${line}")
+    STRING(FIND "${xml}" "${text}" found)
+  ENDIF("${line}" MATCHES "^// XML names: ")
+  IF(found EQUAL -1)
+    SET(missing "${missing}\n  ${text}")
+  ENDIF(found EQUAL -1)
+ENDFOREACH(line)
+IF(missing)
+  MESSAGE(FATAL_ERROR "${NAME}.xml lacks:${missing}")
+ENDIF(missing)
@@ -0,0 +1,29 @@
+# Run gccxml_cc1plus on SOURCE with the sample plugin PLUGIN, which
+# writes the elements it receives back as XML, and fail unless that is
+# the same as the -fxml= dump of the same run.  A plugin cannot tell an
+# element the dump closes with an end tag from one it writes as empty
+# when nothing is nested in it, so such end tags are removed first.
+#
+#   cmake -DCC1PLUS=<exe> -DSOURCE=<file> -DPLUGIN=<library> -DNAME=<name>
+#         -P ComparePlugin.cmake
+
+FOREACH(var CC1PLUS SOURCE PLUGIN NAME)
+  IF(NOT ${var})
+    MESSAGE(FATAL_ERROR "${var} is not set")
+  ENDIF(NOT ${var})
+ENDFOREACH(var)
+
+EXECUTE_PROCESS(
+  COMMAND ${CC1PLUS} -quiet ${SOURCE} -fxml=${NAME}.xml -o ${NAME}.s
+          -fxml-plugin=${PLUGIN} -fxml-plugin-arg=${NAME}.plugin.xml
+  RESULT_VARIABLE result
+)
+IF(result)
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus failed: ${result}")
+ENDIF(result)
+FILE(READ ${NAME}.xml xml)
+STRING(REGEX REPLACE "([^/])>\n *</[A-Za-z_]+>\n" "\\1/>\n" xml "${xml}")
+FILE(READ ${NAME}.plugin.xml plugin_xml)
+IF(NOT "${plugin_xml}" STREQUAL "${xml}")
+  MESSAGE(FATAL_ERROR "${NAME}.plugin.xml differs from ${NAME}.xml")
+ENDIF(NOT "${plugin_xml}" STREQUAL "${xml}")
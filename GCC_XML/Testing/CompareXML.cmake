@@ -0,0 +1,61 @@
+# Run gccxml_cc1plus on SOURCE with and without FLAG, and fail unless
+# the two dumps have the same elements.  The _N ids and the order of
+# the elements are ignored, since FLAG may change the order in which
+# nodes are found.
+#
+#   cmake -DCC1PLUS=<exe> -DSOURCE=<file> -DFLAG=<flag> -DNAME=<name>
+#         [-DFLAGS=<flags>] [-DIMAGE=<file> [-DIMAGE_FLAGS=<flags>]]
+#         [-DDIAGNOSTICS=<regex>] -P CompareXML.cmake
+#
+# FLAGS are given to every run.  With IMAGE, a startup image is first
+# written to that file from an empty source, with FLAGS and
+# IMAGE_FLAGS.  With DIAGNOSTICS, the standard error of the run with
+# FLAG must match that regular expression.
+
+FOREACH(var CC1PLUS SOURCE FLAG NAME)
+  IF(NOT ${var})
+    MESSAGE(FATAL_ERROR "${var} is not set")
+  ENDIF(NOT ${var})
+ENDFOREACH(var)
+
+IF(IMAGE)
+  FILE(WRITE ${NAME}.empty.cxx "")
+  EXECUTE_PROCESS(
+    COMMAND ${CC1PLUS} -quiet ${NAME}.empty.cxx -o ${NAME}.s
+            ${FLAGS} ${IMAGE_FLAGS} -fstartup-image-output=${IMAGE}
+    RESULT_VARIABLE result
+  )
+  IF(result)
+    MESSAGE(FATAL_ERROR "gccxml_cc1plus could not write ${IMAGE}: ${result}")
+  ENDIF(result)
+ENDIF(IMAGE)
+
+MACRO(GX_DUMP out)
+  EXECUTE_PROCESS(
+    COMMAND ${CC1PLUS} -quiet ${SOURCE} -fxml=${out} -o ${NAME}.s
+            ${FLAGS} ${ARGN}
+    RESULT_VARIABLE result
+    ERROR_VARIABLE diagnostics
+  )
+  IF(result)
+    MESSAGE(FATAL_ERROR "gccxml_cc1plus ${ARGN} failed: ${result}\n"
+                        "${diagnostics}")
+  ENDIF(result)
+  FILE(READ ${out} xml)
+  STRING(REGEX REPLACE "_[0-9]+" "_" xml "${xml}")
+  STRING(REGEX REPLACE ";" "\\\;" xml "${xml}")
+  STRING(REGEX REPLACE "\n+$" "" xml "${xml}")
+  STRING(REGEX REPLACE "\n+" ";" xml "${xml}")
+  LIST(SORT xml)
+ENDMACRO(GX_DUMP)
+
+GX_DUMP(${NAME}.a.xml)
+SET(xml_a "${xml}")
+GX_DUMP(${NAME}.b.xml ${FLAG})
+IF(DEFINED DIAGNOSTICS AND NOT "${diagnostics}" MATCHES "${DIAGNOSTICS}")
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus ${FLAG} printed:\n${diagnostics}"
+                      "which does not match \"${DIAGNOSTICS}\"")
+ENDIF(DEFINED DIAGNOSTICS AND NOT "${diagnostics}" MATCHES "${DIAGNOSTICS}")
+IF(NOT "${xml}" STREQUAL "${xml_a}")
+  MESSAGE(FATAL_ERROR "${NAME}.a.xml and ${NAME}.b.xml (${FLAG}) differ")
+ENDIF(NOT "${xml}" STREQUAL "${xml_a}")
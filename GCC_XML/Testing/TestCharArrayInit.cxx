@@ -0,0 +1,26 @@
+// Initializer lists of char arrays, which reshape_init keeps as strings
+// of bytes.  The dump must print them as the lists the full conversion
+// of each element gives.
+
+// XML: name="u" type="_" init="{18u, 255u, 0u, 97u}"
+unsigned char u[] = {0x12, 0xff, 0, 'a'};
+
+// XML: name="s" type="_" init="{-0x00000000000000001, 127, -0x00000000000000080}"
+signed char s[4] = {-1, 127, -128};
+
+// XML: name="c" type="_" init="{&apos;x&apos;, &apos;\012&apos;, &apos;\000&apos;}"
+char c[] = {'x', 10, 0};
+
+// XML: name="nested" type="_" init="{{1u, 2u, 3u}, {4u, 5u}}"
+unsigned char nested[2][3] = {{1, 2, 3}, {4, 5}};
+
+// XML: name="elided" type="_" init="{{1u, 2u}, {3u}}"
+unsigned char elided[2][2] = {1, 2, 3};
+
+// XML: name="records" type="_" init="{{1, {7u, 8u, 9u}}, {2, {250u, 251u}}}"
+struct Record { int n; unsigned char bytes[3]; };
+Record records[] = {{1, {7, 8, 9}}, 2, 250, 251};
+
+// XML: name="repeated" type="_c" init="{-0x00000000000000001, -0x00000000000000001, -0x00000000000000001, 5}"
+typedef signed char Byte;
+const Byte repeated[] = {-1, -1, -1, 5};
@@ -0,0 +1,24 @@
+// Four chains of class, static member and function template
+// instantiations, each GX_DEPTH levels deep.  This is also the input
+// used to time the instantiation frame stack:
+//   gccxml_cc1plus -quiet -ftime-report -fmem-report TestDeepInstantiation.cxx
+// -fmem-report prints how many levels were pushed and how many
+// TINST_LEVEL nodes had to be built.
+#ifndef GX_DEPTH
+# define GX_DEPTH 400
+#endif
+template <class T, int N> struct F { enum { value = F<T, N-1>::value + 1 }; typedef F<T, N-1> prev; };
+template <class T> struct F<T, 0> { enum { value = 0 }; };
+template <class T, int N> struct G { static int get() { return G<T, N-1>::get() + 1; } };
+template <class T> struct G<T, 0> { static int get() { return 0; } };
+template <class T, int N> int h(T t) { return h<T, N-1>(t) + 1; }
+#define GX_CHAIN(C) \
+  struct C {}; \
+  template <> int h<C, 0>(C) { return 0; } \
+  int a_##C = F<C, GX_DEPTH>::value; \
+  int b_##C = G<C, GX_DEPTH>::get(); \
+  int c_##C = h<C, GX_DEPTH>(C());
+GX_CHAIN(C0)
+GX_CHAIN(C1)
+GX_CHAIN(C2)
+GX_CHAIN(C3)
@@ -0,0 +1,12 @@
+// Instantiation-context diagnostics: a depth-limit backtrace, and the
+// context of a deferred instantiation that is reopened at end of file.
+template <class T> struct A { void f() { T::nothing(); } };
+template <class T> struct B { void g() { A<T> a; a.f(); } };
+template <class T> void h() { B<T> b; b.g(); }
+template <int N> struct R { enum { v = R<N+1>::v }; };
+struct X {};
+void k() { h<X>(); }
+int z = R<0>::v;
+template <class T> void later();
+void use() { later<int>(); }
+template <class T> void later() { T::missing(); }
@@ -0,0 +1,6 @@
+// The declaration of an unused member function of an implicitly
+// instantiated class is still checked by default, even when the class
+// is not in the dump.
+template <class T> struct A { void f(typename T::type); int g; };
+A<int> a;
+struct B {};
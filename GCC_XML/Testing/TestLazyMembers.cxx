@@ -0,0 +1,61 @@
+// Class template instantiations whose member functions are mostly
+// unused.  The dump must have the same elements with and without
+// -flazy-template-members.
+namespace lazy
+{
+  template <class T> struct traits
+  {
+    typedef T type;
+    enum { value = sizeof (T) };
+    static T make ();
+    T copy (T const &) const;
+    void reset ();
+    void reset (int);
+    int size () const { return value; }
+  };
+
+  template <class T> struct base
+  {
+    void f (T);
+    int g () const;
+  };
+
+  template <class T> struct derived : base<T>
+  {
+    using base<T>::f;
+    void f (T, T);
+    void h (typename traits<T>::type);
+    derived & operator= (derived const &);
+  };
+
+  template <class T> struct holder
+  {
+    T value;
+    typename traits<T>::type get () const;
+    void set (T const &);
+    template <class U> void assign (U const &);
+  };
+
+  template <> struct traits<char>
+  {
+    typedef int type;
+    static int make ();
+  };
+
+  template struct holder<long>;
+
+  struct user
+  {
+    traits<int>::type a;
+    int b[traits<double>::value];
+    derived<short> d;
+    holder<float> h;
+    traits<char>::type c;
+  };
+
+  inline int use (holder<unsigned> &x)
+  {
+    x.set (1u);
+    return traits<unsigned>::make () + x.get ();
+  }
+}
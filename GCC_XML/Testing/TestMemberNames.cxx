@@ -0,0 +1,40 @@
+// A class whose class-scope enumeration has more enumerators than
+// lookup_field_1 walks before it keeps the names of the members of the
+// class being defined in a set.  The set must also have the members of
+// an anonymous union declared after it was made, and lookups must still
+// find them once the set is dropped as the class is laid out.
+
+struct Members;
+template <char Members::*> struct Pointer {};
+
+struct Members
+{
+  enum Many
+  {
+    E0, E1, E2, E3, E4, E5, E6, E7, E8, E9,
+    E10, E11, E12, E13, E14, E15, E16, E17, E18, E19,
+    E20, E21, E22, E23, E24, E25, E26, E27, E28, E29,
+    E30, E31, E32, E33, E34, E35, E36, E37, E38, E39,
+    E40, E41, E42, E43, E44, E45, E46, E47, E48, E49,
+    E50, E51, E52, E53, E54, E55, E56, E57, E58, E59,
+    E60, E61, E62, E63, E64, E65, E66, E67, E68, E69
+  };
+
+  // XML: <Field id="_" name="u1" type="_" offset="0" context="_" access="public"
+  // XML: <Field id="_" name="u2" type="_" offset="0" context="_" access="public"
+  union { int u1; char u2; };
+
+  // Looked up in the set while the class is being defined.
+  // XML: <Struct id="_" name="Pointer&lt;&amp;Members::u2&gt;"
+  // XML: <EnumValue name="Last" init="69"/>
+  enum After { Last = E69 };
+  typedef Pointer<&Members::u2> U2;
+
+  // Looked up after the class is laid out.
+  int get() { return u1 + u2 + E0; }
+};
+
+// XML: name="member" type="_" init="&amp;Members::u1"
+int Members::* member = &Members::u1;
+// XML: name="value" type="_" init="69"
+int value = Members::E69;
@@ -0,0 +1,33 @@
+// The overrides attribute of virtual functions in a hierarchy with
+// multiple and virtual inheritance.  Each attribute lists the function
+// nearest along every path to a base that declares one of the same
+// signature, so a diamond lists the shared base more than once.
+
+// XML names: id="A::f()" name="f" returns="_" virtual="1" overrides=""
+// XML names: id="A::operator int()" name="operator 1" returns="_" virtual="1" overrides=""
+struct A
+{
+  virtual ~A();
+  virtual void f();
+  virtual void f(int);
+  virtual operator int();
+};
+
+// XML names: id="B1::f()" name="f" returns="_" virtual="1" overrides="A::f() "
+struct B1: virtual A { void f(); };
+
+// XML names: id="B2::f(int)" name="f" returns="_" virtual="1" overrides="A::f(int) "
+// XML names: id="B2::operator int()" name="operator 1" returns="_" virtual="1" overrides="A::operator int() "
+struct B2: virtual A { void f(int); operator int(); };
+
+// XML names: id="C::f()" name="f" returns="_" virtual="1" overrides="B1::f() A::f() "
+// XML names: id="C::f(int)" name="f" returns="_" virtual="1" overrides="A::f(int) B2::f(int) "
+// XML names: id="C::g()" name="g" returns="_" virtual="1" overrides=""
+// XML names: id="C::~C()" name="C" virtual="1" overrides="B1::~B1() B2::~B2() "
+struct C: B1, B2 { void f(); void f(int); virtual void g(); ~C(); };
+
+struct X { virtual void f(); };
+
+// XML names: id="D::f()" name="f" returns="_" virtual="1" overrides="C::f() X::f() "
+// XML names: id="D::g()" name="g" returns="_" virtual="1" overrides="C::g() "
+struct D: C, X { void f(); void g(); };
@@ -0,0 +1,7 @@
+// With -w -Wpointer-arith this is still an error in C++, because the
+// pedwarn -Wpointer-arith enables is an error without -fpermissive.
+void* f(void* p) { return p + 1; }
+
+// With -w -pedantic-errors the extra tokens after #endif are an error.
+#ifdef PEDWARN_WITH_W
+#endif PEDWARN_WITH_W
@@ -0,0 +1,178 @@
+/*=========================================================================
+
+  Program:   GCC-XML
+  Module:    $RCSfile: TestPlugin.c,v $
+  Language:  C
+  Date:      $Date$
+  Version:   $Revision$
+
+  Copyright (c) 2002 Kitware, Inc., Insight Consortium.  All rights reserved.
+  See Copyright.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notices for more information.
+
+=========================================================================*/
+/* A sample -fxml-plugin= consumer.  It writes the elements it receives
+   back as XML, in the layout of the -fxml= dump, to the file named by
+   -fxml-plugin-arg=<file>.  So that the kinds of the attribute values
+   can be checked too, it writes one line per attribute with the
+   element, attribute and value kind to <file>.kinds.  */
+
+#include "gccxml_plugin.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+# define TEST_PLUGIN_EXPORT __declspec(dllexport)
+#else
+# define TEST_PLUGIN_EXPORT
+#endif
+
+typedef struct TestPluginFiles
+{
+  FILE* xml;
+  FILE* kinds;
+
+  /* Whether the last start tag written is not finished yet.  Only the
+     next callback tells whether the element is empty.  */
+  int open;
+} TestPluginFiles;
+
+/*--------------------------------------------------------------------------*/
+static const char* TestPluginKind(gccxml_value_kind kind)
+{
+  switch(kind)
+    {
+    case gccxml_value_id: return "id";
+    case gccxml_value_idref: return "idref";
+    case gccxml_value_idrefs: return "idrefs";
+    case gccxml_value_string: return "string";
+    }
+  return "unknown";
+}
+
+/*--------------------------------------------------------------------------*/
+/* Write VALUE with the characters the dump escapes replaced.  */
+static void TestPluginWriteValue(FILE* out, const gccxml_string* value)
+{
+  size_t i;
+  for(i=0; i < value->length; ++i)
+    {
+    switch(value->data[i])
+      {
+      case '&': fputs("&amp;", out); break;
+      case '<': fputs("&lt;", out); break;
+      case '>': fputs("&gt;", out); break;
+      case '\'': fputs("&apos;", out); break;
+      case '"': fputs("&quot;", out); break;
+      default: putc(value->data[i], out); break;
+      }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+static void TestPluginIndent(FILE* out, unsigned int depth)
+{
+  unsigned int i;
+  for(i=0; i < depth; ++i)
+    {
+    fputs("  ", out);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+static void TestPluginStart(void* data, const gccxml_element* element)
+{
+  TestPluginFiles* files = (TestPluginFiles*)data;
+  unsigned int i;
+  if(element->depth == 0)
+    {
+    fputs("<?xml version=\"1.0\"?>\n", files->xml);
+    }
+  if(files->open)
+    {
+    fputs(">\n", files->xml);
+    }
+  TestPluginIndent(files->xml, element->depth);
+  fprintf(files->xml, "<%.*s", (int)element->kind.length,
+          element->kind.data);
+  for(i=0; i < element->num_attributes; ++i)
+    {
+    const gccxml_attribute* a = &element->attributes[i];
+    fprintf(files->xml, " %.*s=\"", (int)a->name.length, a->name.data);
+    TestPluginWriteValue(files->xml, &a->value);
+    putc('"', files->xml);
+    fprintf(files->kinds, "%.*s %.*s %s\n",
+            (int)element->kind.length, element->kind.data,
+            (int)a->name.length, a->name.data, TestPluginKind(a->kind));
+    }
+  files->open = 1;
+}
+
+/*--------------------------------------------------------------------------*/
+static void TestPluginEnd(void* data, const gccxml_element* element)
+{
+  TestPluginFiles* files = (TestPluginFiles*)data;
+  if(files->open)
+    {
+    fputs("/>\n", files->xml);
+    files->open = 0;
+    return;
+    }
+  TestPluginIndent(files->xml, element->depth);
+  fprintf(files->xml, "</%.*s>\n", (int)element->kind.length,
+          element->kind.data);
+}
+
+/*--------------------------------------------------------------------------*/
+static void TestPluginFinish(void* data)
+{
+  TestPluginFiles* files = (TestPluginFiles*)data;
+  fclose(files->xml);
+  fclose(files->kinds);
+  free(files);
+}
+
+/*--------------------------------------------------------------------------*/
+TEST_PLUGIN_EXPORT int gccxml_plugin_init(unsigned int api_version,
+                                          const char* arg,
+                                          gccxml_plugin* plugin)
+{
+  TestPluginFiles* files;
+  char* kinds;
+  if(api_version != GCCXML_PLUGIN_API_VERSION || !arg)
+    {
+    return 1;
+    }
+  files = (TestPluginFiles*)malloc(sizeof(TestPluginFiles));
+  kinds = (char*)malloc(strlen(arg) + sizeof(".kinds"));
+  strcpy(kinds, arg);
+  strcat(kinds, ".kinds");
+  files->xml = fopen(arg, "w");
+  files->open = 0;
+  files->kinds = fopen(kinds, "w");
+  free(kinds);
+  if(!files->xml || !files->kinds)
+    {
+    if(files->xml)
+      {
+      fclose(files->xml);
+      }
+    if(files->kinds)
+      {
+      fclose(files->kinds);
+      }
+    free(files);
+    return 1;
+    }
+  plugin->api_version = GCCXML_PLUGIN_API_VERSION;
+  plugin->data = files;
+  plugin->start_element = TestPluginStart;
+  plugin->end_element = TestPluginEnd;
+  plugin->finish = TestPluginFinish;
+  return 0;
+}
@@ -0,0 +1,30 @@
+// Elements of most kinds, and names and values with characters the
+// dump escapes.
+namespace ns
+{
+  struct Base2 {};
+  struct Other;
+  struct Base
+  {
+    virtual ~Base();
+    virtual int f(int) throw(int, char);
+    bool operator<(const Base&) const;
+  };
+
+  class Derived: public Base, protected virtual Base2
+  {
+    friend struct Other;
+  public:
+    int f(int) throw(int);
+    int Derived::* member;
+    int (Derived::*method)(int);
+  };
+
+  template <typename T> struct Holder { T value; };
+  typedef Holder<const char*> CharHolder;
+
+  enum Colour { red, green = 'g' };
+  const char* const quoted = "a \"b\" & 'c' <d>";
+  void g(int x = 1 << 2, CharHolder h = CharHolder());
+}
+namespace alias = ns;
@@ -0,0 +1,233 @@
+/*=========================================================================
+
+  Program:   GCC-XML
+  Module:    $RCSfile: TestSession.cxx,v $
+  Language:  C++
+  Date:      $Date$
+  Version:   $Revision$
+
+  Copyright (c) 2002 Kitware, Inc., Insight Consortium.  All rights reserved.
+  See Copyright.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notices for more information.
+
+=========================================================================*/
+// Test of the gccxml library.  Usage:
+//
+//   TestSession <gccxml> <config> <plugin> <file>
+//
+// A session is created as if running <gccxml> with --gccxml-config
+// <config>, so the test does not depend on a supported host compiler.
+// It parses a source held in memory that includes a header override,
+// then the same source with a different override, and then one whose
+// source and output are both larger than a pipe buffer.
+//
+// Every parse also runs the sample plugin <plugin>, which lists the
+// kind gccxml_cc1plus gives each attribute in <file>.kinds.  The last
+// parse is streamed, and the kinds the stream gives must be the same.
+
+#include "gccxml_session.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+static int failures = 0;
+
+//----------------------------------------------------------------------------
+static void TestSessionFail(const char* what, gccxml_session* session)
+{
+  fprintf(stderr, "TestSession: %s\n%s", what,
+          gccxml_session_diagnostics(session));
+  ++failures;
+}
+
+//----------------------------------------------------------------------------
+// Parse SOURCE with the header override HEADER and check that the
+// output contains each of the strings in EXPECT.
+static void TestSessionParse(gccxml_session* session,
+                             const std::string& source,
+                             const std::string& header,
+                             const char* const* expect)
+{
+  gccxml_file files[2] =
+    {
+      {"session/test.cxx", source.data(), source.size()},
+      {"session/test.h", header.data(), header.size()}
+    };
+  if(gccxml_session_parse(session, &files[0], &files[1], 1) != 0)
+    {
+    TestSessionFail("parse failed", session);
+    return;
+    }
+  size_t length;
+  std::string output(gccxml_session_output(session, &length));
+  if(output.size() != length)
+    {
+    TestSessionFail("output length does not match", session);
+    }
+  for(; *expect; ++expect)
+    {
+    if(output.find(*expect) == output.npos)
+      {
+      fprintf(stderr, "TestSession: output lacks %s\n", *expect);
+      ++failures;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+// A consumer that lists the attribute kinds the way the sample plugin
+// does and checks that the elements are properly nested.
+struct TestSessionKinds
+{
+  std::string m_Kinds;
+  std::vector<const gccxml_element*> m_Open;
+  bool m_Finished;
+};
+
+//----------------------------------------------------------------------------
+static void TestSessionStart(void* data, const gccxml_element* element)
+{
+  static const char* const kinds[] = {"id", "idref", "idrefs", "string"};
+  TestSessionKinds* consumer = static_cast<TestSessionKinds*>(data);
+  if(element->depth != consumer->m_Open.size() ||
+     element->parent != (element->depth? consumer->m_Open.back() : 0))
+    {
+    fprintf(stderr, "TestSession: element misplaced in the stream\n");
+    ++failures;
+    }
+  consumer->m_Open.push_back(element);
+  for(unsigned int i=0; i < element->num_attributes; ++i)
+    {
+    const gccxml_attribute& a = element->attributes[i];
+    consumer->m_Kinds.append(element->kind.data, element->kind.length);
+    consumer->m_Kinds += " ";
+    consumer->m_Kinds.append(a.name.data, a.name.length);
+    consumer->m_Kinds += " ";
+    consumer->m_Kinds += kinds[a.kind];
+    consumer->m_Kinds += "\n";
+    }
+}
+
+//----------------------------------------------------------------------------
+static void TestSessionEnd(void* data, const gccxml_element* element)
+{
+  TestSessionKinds* consumer = static_cast<TestSessionKinds*>(data);
+  if(consumer->m_Open.empty() || consumer->m_Open.back() != element)
+    {
+    fprintf(stderr, "TestSession: element ended out of order\n");
+    ++failures;
+    return;
+    }
+  consumer->m_Open.pop_back();
+}
+
+//----------------------------------------------------------------------------
+static void TestSessionFinish(void* data)
+{
+  static_cast<TestSessionKinds*>(data)->m_Finished = true;
+}
+
+//----------------------------------------------------------------------------
+// Stream the output of the last parse and compare the attribute kinds
+// with those the plugin listed in KINDS.
+static void TestSessionStream(gccxml_session* session, const char* kinds)
+{
+  TestSessionKinds consumer;
+  consumer.m_Finished = false;
+  gccxml_plugin callbacks =
+    {GCCXML_PLUGIN_API_VERSION, &consumer,
+     TestSessionStart, TestSessionEnd, TestSessionFinish};
+  if(gccxml_session_stream(session, &callbacks) != 0 ||
+     !consumer.m_Finished || !consumer.m_Open.empty())
+    {
+    TestSessionFail("stream failed", session);
+    return;
+    }
+
+  std::string expected;
+  FILE* file = fopen(kinds, "rb");
+  if(!file)
+    {
+    fprintf(stderr, "TestSession: cannot read %s\n", kinds);
+    ++failures;
+    return;
+    }
+  char buffer[4096];
+  size_t n;
+  while((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+    expected.append(buffer, n);
+    }
+  fclose(file);
+  if(consumer.m_Kinds != expected)
+    {
+    fprintf(stderr, "TestSession: the stream gives other attribute kinds "
+            "than gccxml_cc1plus, listed in %s\n", kinds);
+    ++failures;
+    }
+}
+
+//----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  if(argc != 5)
+    {
+    fprintf(stderr,
+            "Usage: TestSession <gccxml> <config> <plugin> <file>\n");
+    return 1;
+    }
+  std::string plugin = std::string("-fxml-plugin=") + argv[3];
+  std::string pluginArg = std::string("-fxml-plugin-arg=") + argv[4];
+  std::string kinds = std::string(argv[4]) + ".kinds";
+  const char* args[] = {argv[1], "--gccxml-config", argv[2],
+                        plugin.c_str(), pluginArg.c_str()};
+  gccxml_session* session = gccxml_session_create(5, args);
+  if(!session)
+    {
+    fprintf(stderr, "TestSession: could not create the session\n");
+    return 1;
+    }
+
+  std::string source =
+    "#include \"test.h\"\n"
+    "struct Derived: Base { int y; };\n";
+  const char* expect1[] =
+    {"name=\"Base\"", "name=\"Derived\"", "name=\"x\"", "name=\"y\"", 0};
+  TestSessionParse(session, source, "struct Base { int x; };\n", expect1);
+
+  // The override belongs to one parse only.
+  const char* expect2[] = {"name=\"Base\"", "name=\"z\"", 0};
+  TestSessionParse(session, source, "struct Base { int z; };\n", expect2);
+
+  // Files and output larger than a pipe holds.
+  std::string header;
+  for(int i=0; i < 4000; ++i)
+    {
+    char line[64];
+    sprintf(line, "struct Large%d { int member%d; };\n", i, i);
+    header += line;
+    }
+  const char* expect3[] = {"name=\"Large0\"", "name=\"member3999\"", 0};
+  TestSessionParse(session, "#include \"test.h\"\n", header, expect3);
+
+  // Every attribute that refers to other elements.
+  std::string references =
+    "namespace ns {\n"
+    "  struct B { virtual ~B(); virtual int f(int) throw(int); };\n"
+    "  struct D: B { friend struct F; int f(int) throw(int);\n"
+    "                int D::* m; int (D::*p)(int); };\n"
+    "}\n"
+    "namespace alias = ns;\n";
+  const char* expect4[] = {"name=\"alias\"", 0};
+  TestSessionParse(session, references, "", expect4);
+  TestSessionStream(session, kinds.c_str());
+
+  gccxml_session_destroy(session);
+  return failures? 1 : 0;
+}
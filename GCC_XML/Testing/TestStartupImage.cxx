@@ -0,0 +1,7 @@
+// Uses the declarations of TestStartupImage.h, which is given with
+// -include, as restored from a startup image or read normally.
+namespace image
+{
+  struct Derived: Base { Ints ints; Array<char, STARTUP_IMAGE_SIZE*2> s; };
+  Mode mode = write;
+}
@@ -0,0 +1,11 @@
+// The -include file of the startup image tests.  Its declarations,
+// templates and macros come from the image when it is restored.
+#define STARTUP_IMAGE_SIZE 4
+
+namespace image
+{
+  template <typename T, int N> struct Array { T data[N]; };
+  struct Base { virtual ~Base(); int size() const; };
+  typedef Array<int, STARTUP_IMAGE_SIZE> Ints;
+  enum Mode { read, write };
+}
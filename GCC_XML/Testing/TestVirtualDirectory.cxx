@@ -0,0 +1,4 @@
+// The file list given with this source enters virtual/dir/a.h and
+// then a file named virtual/dir, which must be reported rather than
+// replace the directory.
+struct C {};
@@ -0,0 +1,62 @@
+# Run gccxml_cc1plus on SOURCE with -ftime-report-file and fail unless
+# the file has a header line and a TOTAL line whose hardware counters
+# are numbers or "-".  Then run it without -quiet, which prints the
+# report without opening the counters, and fail if the report shows
+# counter columns for them anyway.
+#
+#   cmake -DCC1PLUS=<exe> -DSOURCE=<file> -DNAME=<name> -P TimeReport.cmake
+
+FOREACH(var CC1PLUS SOURCE NAME)
+  IF(NOT ${var})
+    MESSAGE(FATAL_ERROR "${var} is not set")
+  ENDIF(NOT ${var})
+ENDFOREACH(var)
+
+FILE(REMOVE ${NAME}.tsv)
+EXECUTE_PROCESS(
+  COMMAND ${CC1PLUS} -quiet ${SOURCE} -fxml=${NAME}.xml -o ${NAME}.s
+          -ftime-report-file=${NAME}.tsv
+  RESULT_VARIABLE result
+  ERROR_VARIABLE diagnostics
+)
+IF(result)
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus failed: ${result}\n${diagnostics}")
+ENDIF(result)
+IF(diagnostics)
+  MESSAGE(FATAL_ERROR
+    "-ftime-report-file alone printed to the terminal:\n${diagnostics}")
+ENDIF(diagnostics)
+IF(NOT EXISTS ${NAME}.tsv)
+  MESSAGE(FATAL_ERROR "-ftime-report-file did not write ${NAME}.tsv")
+ENDIF(NOT EXISTS ${NAME}.tsv)
+
+SET(number "[0-9]+(\\.[0-9]+)?")
+SET(header_regex "^# timevar\tuser\tsys\twall\tggc_kb\trss_kb\theap_kb\t")
+SET(total_regex "^TOTAL\t${number}\t${number}\t${number}")
+SET(total_regex "${total_regex}\t[0-9]+\t[0-9]+\t[0-9]+(\t([0-9]+|-))+$")
+FILE(STRINGS ${NAME}.tsv lines)
+LIST(GET lines 0 header)
+IF(NOT "${header}" MATCHES "${header_regex}")
+  MESSAGE(FATAL_ERROR "${NAME}.tsv has no header line:\n${header}")
+ENDIF(NOT "${header}" MATCHES "${header_regex}")
+FILE(STRINGS ${NAME}.tsv total REGEX "^TOTAL\t")
+IF(NOT "${total}" MATCHES "${total_regex}")
+  MESSAGE(FATAL_ERROR "${NAME}.tsv has no valid TOTAL line:\n${total}")
+ENDIF(NOT "${total}" MATCHES "${total_regex}")
+
+EXECUTE_PROCESS(
+  COMMAND ${CC1PLUS} ${SOURCE} -fxml=${NAME}.xml -o ${NAME}.s
+  RESULT_VARIABLE result
+  OUTPUT_VARIABLE output
+  ERROR_VARIABLE report
+)
+IF(result)
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus failed: ${result}\n${report}")
+ENDIF(result)
+IF(NOT "${report}" MATCHES "TOTAL")
+  MESSAGE(FATAL_ERROR "gccxml_cc1plus printed no time report:\n${report}")
+ENDIF(NOT "${report}" MATCHES "TOTAL")
+IF("${report}" MATCHES " cyc|Hardware counters")
+  MESSAGE(FATAL_ERROR
+    "the time report shows counters that were not requested:\n${report}")
+ENDIF("${report}" MATCHES " cyc|Hardware counters")